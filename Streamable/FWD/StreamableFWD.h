@@ -8,11 +8,19 @@
 
 namespace hbann
 {
+template <typename> class Columnar;
 class Converter;
+template <typename> class Deleter;
 class IStreamable;
+class IStreamableCached;
+template <typename> class Rectangular;
+class Key;
+class Reflector;
 class Size;
 class SizeFinder;
 class Stream;
+class StreamContext;
 class StreamReader;
 class StreamWriter;
+class Tag;
 } // namespace hbann
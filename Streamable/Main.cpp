@@ -31,8 +31,11 @@ constexpr auto LICENSE = R"(/*
     SOFTWARE.
 */)"sv;
 
-constexpr auto FILES = {R"(Utilities/Converter.h)"sv,  R"(Utilities/Size.h)"sv,       R"(Streams/Stream.h)"sv,
-                        R"(Utilities/SizeFinder.h)"sv, R"(Streams/StreamReader.h)"sv, R"(Streams/StreamWriter.h)"sv};
+constexpr auto FILES = {R"(Utilities/Converter.h)"sv,  R"(Utilities/Size.h)"sv,        R"(Utilities/Reflector.h)"sv,
+                        R"(Utilities/Deleter.h)"sv,    R"(Streams/StreamContext.h)"sv, R"(Streams/Stream.h)"sv,
+                        R"(Utilities/SizeFinder.h)"sv, R"(Utilities/Tag.h)"sv,         R"(Utilities/Key.h)"sv,
+                        R"(Utilities/Dense.h)"sv,      R"(Utilities/Rectangular.h)"sv, R"(Utilities/Columnar.h)"sv,
+                        R"(Streams/StreamReader.h)"sv, R"(Streams/StreamWriter.h)"sv};
 
 constexpr auto FILE_FWD = R"(FWD/StreamableFWD.h)"sv;
 constexpr auto FILE_PCH = R"(pch.h)"sv;
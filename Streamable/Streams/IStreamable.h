@@ -26,8 +26,23 @@ class IStreamable
         return Release();
     }
 
+    [[nodiscard]] decltype(auto) Serialize(StreamContext &aContext)
+    {
+        aContext.Clear();
+
+        Swap(Stream(aContext));
+        ToStream();
+        return Release();
+    }
+
     constexpr void Deserialize(Stream &&aStream, const bool aClear = true)
     {
+        if (const auto context = aStream.GetContext())
+        {
+            context->Clear();
+        }
+
+        Invalidate();
         Swap(std::move(aStream));
         FromStream();
 
@@ -37,6 +52,46 @@ class IStreamable
         }
     }
 
+    /*
+        Like Deserialize, but the errors of the stream are returned instead of thrown, the streamable is in an
+        unspecified state then. The exceptions of the allocations and of the user's code (FromStream, factories) are
+        still thrown.
+    */
+    [[nodiscard]] StreamContext::Result TryDeserialize(Stream &&aStream)
+    {
+        // without a context of the caller we use our own just for this deserialization
+        StreamContext contextOwn;
+        const auto context = aStream.GetContext() ? aStream.GetContext() : &contextOwn;
+        const auto view = aStream.View();
+
+        context->Clear();
+        context->mThrows = false;
+
+        Invalidate();
+        Swap(Stream(view, *context));
+
+        try
+        {
+            FromStream();
+        }
+        catch (...)
+        {
+            Swap(Stream());
+            context->mThrows = true;
+            throw;
+        }
+
+        Swap(Stream());
+        context->mThrows = true;
+
+        if (context->mStatus == StreamContext::Status::OK)
+        {
+            return {};
+        }
+
+        return {context->mStatus, static_cast<Size::size_max>(context->mStatusPosition - view.data())};
+    }
+
   protected:
     StreamWriter mStreamWriter;
     StreamReader mStreamReader;
@@ -56,6 +111,17 @@ class IStreamable
     {
     }
 
+    // called before the streamable is deserialized, it drops what depends on its old state
+    virtual void Invalidate() noexcept
+    {
+    }
+
+    // the columns of the bases, hidden by STREAMABLE_DEFINE_BASE
+    [[nodiscard]] constexpr std::tuple<> StreamableColumnsBases() noexcept
+    {
+        return {};
+    }
+
     [[nodiscard]] constexpr Stream &&Release() noexcept
     {
         return std::move(mStream);
@@ -96,4 +162,52 @@ class IStreamable
         return *this;
     }
 };
+
+/*
+    Streamable that keeps its last encoding, so when it's nested in another one it's copied instead of serialized again
+
+    The code changing it must call MarkDirty, also for the streamables that contain it because a clean streamable is
+    not visited, deserializing it (through a base too) marks it. The encoding is not kept when the shared pointers are
+    written by identity, it depends on the objects written before it.
+*/
+class IStreamableCached : public IStreamable
+{
+    friend class StreamWriter;
+    friend class StreamReader;
+
+    Stream::vector mCache;
+    StreamContext::Option mCacheOptions = StreamContext::Option::NONE;
+    bool mDirty = true;
+
+  public:
+    constexpr void MarkDirty() noexcept
+    {
+        mDirty = true;
+    }
+
+    [[nodiscard]] constexpr bool IsDirty() const noexcept
+    {
+        return mDirty;
+    }
+
+  protected:
+    constexpr IStreamableCached() noexcept = default;
+
+    void Invalidate() noexcept override
+    {
+        MarkDirty();
+    }
+
+    [[nodiscard]] constexpr bool IsCached(const StreamContext::Option aOptions) const noexcept
+    {
+        return !mDirty && mCacheOptions == aOptions;
+    }
+
+    constexpr void Cache(const Stream::span aStream, const StreamContext::Option aOptions)
+    {
+        mCache.assign(aStream.begin(), aStream.end());
+        mCacheOptions = aOptions;
+        mDirty = false;
+    }
+};
 } // namespace hbann
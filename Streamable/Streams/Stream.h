@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "StreamContext.h"
 #include "Utilities/Size.h"
 
 namespace hbann
@@ -31,6 +32,14 @@ class Stream
     {
     }
 
+    constexpr explicit Stream(StreamContext &aContext) noexcept : mStream(vector()), mContext(&aContext)
+    {
+    }
+
+    constexpr Stream(const span aSpan, StreamContext &aContext) noexcept : mStream(aSpan), mContext(&aContext)
+    {
+    }
+
     constexpr Stream(Stream &&aStream) noexcept
     {
         *this = std::move(aStream);
@@ -66,12 +75,35 @@ class Stream
         return spen ? *spen : GetStream();
     }
 
+    [[nodiscard]] constexpr StreamContext *GetContext() const noexcept
+    {
+        return mContext;
+    }
+
     [[nodiscard]] constexpr auto CanRead(const Size::size_max aSize) noexcept
     {
         const auto view = View();
         return mReadIndex + aSize <= view.size();
     }
 
+    [[nodiscard]] constexpr Size::size_max Remaining() noexcept
+    {
+        const auto view = View();
+        return mReadIndex < view.size() ? view.size() - mReadIndex : 0;
+    }
+
+    [[nodiscard]] constexpr const uint8_t *Position() noexcept
+    {
+        return View().data() + mReadIndex;
+    }
+
+    // nothing else will be read
+    constexpr decltype(auto) Skip() noexcept
+    {
+        mReadIndex = View().size();
+        return *this;
+    }
+
     [[nodiscard]] constexpr auto Read(const Size::size_max aSize)
     {
         ThrowIfCantRead(aSize);
@@ -80,6 +112,15 @@ class Stream
         return span{View().data() + (mReadIndex - aSize), aSize};
     }
 
+    // the nested stream shares our context
+    [[nodiscard]] constexpr Stream ReadStream(const Size::size_max aSize)
+    {
+        Stream streamNested(Read(aSize));
+        streamNested.mContext = mContext;
+
+        return streamNested;
+    }
+
     [[nodiscard]] constexpr auto Current()
     {
         ThrowIfCantRead(1);
@@ -92,6 +133,21 @@ class Stream
         return *this;
     }
 
+    // the bytes are written in place by the caller
+    [[nodiscard]] constexpr uint8_t *Extend(const Size::size_max aSize)
+    {
+        const auto size = GetStream().size();
+        GetStream().resize(size + aSize);
+
+        return GetStream().data() + size;
+    }
+
+    constexpr decltype(auto) Insert(const Size::size_max aOffset, const span aSpan)
+    {
+        GetStream().insert(GetStream().begin() + aOffset, aSpan.data(), aSpan.data() + aSpan.size());
+        return *this;
+    }
+
     constexpr Stream &operator=(const Stream &) noexcept
     {
         return *this;
@@ -101,6 +157,7 @@ class Stream
     {
         mStream = std::move(aStream.mStream);
         mReadIndex = aStream.mReadIndex;
+        mContext = aStream.mContext;
 
         return *this;
     }
@@ -114,6 +171,7 @@ class Stream
   private:
     stream mStream{};
     Size::size_max mReadIndex{};
+    StreamContext *mContext{};
 
     constexpr vector &GetStream() noexcept
     {
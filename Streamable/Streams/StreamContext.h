@@ -0,0 +1,156 @@
+/*
+    Copyright (c) 2024 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma once
+
+#include "Utilities/Deleter.h"
+#include "Utilities/Size.h"
+
+namespace hbann
+{
+/*
+    Options and state shared by a stream and every stream of the nested streamables inside it
+
+    The context must outlive the streams using it.
+*/
+class StreamContext
+{
+  public:
+    enum class Option : uint8_t
+    {
+        NONE = 0,
+        // shared pointers to the same object are written once, then referenced by their identity
+        IDENTITY = 1 << 0,
+        // the elements of ranges of objects of known size are padded to their alignment, so they can be used in place
+        ALIGNED = 1 << 1,
+        // equal objects are written in equal bytes, unordered containers are sorted and floating points normalized
+        CANONICAL = 1 << 2
+    };
+
+    enum class Status : uint8_t
+    {
+        OK,
+        // a field or a count was cut by the end of the stream
+        TRUNCATED,
+        // a count asks for more bytes than there are left
+        INVALID_COUNT,
+        // a variant alternative, derived streamable or shared object identity that doesn't exist
+        INVALID_INDEX,
+        // a limit of the reader was exceeded
+        OVER_LIMIT,
+        // a span can't point to elements that are not aligned in the stream
+        MISALIGNED
+    };
+
+    // the budget of a deserialization, the bytes are the sizes of the objects allocated for ranges and pointers
+    struct Limits
+    {
+        Size::size_max bytes = std::numeric_limits<Size::size_max>::max();
+        Size::size_max count = std::numeric_limits<Size::size_max>::max();
+        Size::size_max depth = std::numeric_limits<Size::size_max>::max();
+    };
+
+    // the first error of a deserialization and its offset in the stream
+    struct Result
+    {
+        Status status = Status::OK;
+        Size::size_max offset{};
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return status == Status::OK;
+        }
+    };
+
+    StreamContext() noexcept = default;
+
+    /*
+        The objects allocated by the reader for smart pointers will use the memory resource: std::shared_ptr and
+        std::unique_ptr with hbann::Deleter, the ones with std::default_delete and the raw pointers still use new
+    */
+    explicit StreamContext(std::pmr::memory_resource *aMemoryResource) noexcept : mMemoryResource(aMemoryResource)
+    {
+    }
+
+    explicit StreamContext(const Option aOptions, std::pmr::memory_resource *aMemoryResource = nullptr) noexcept
+        : mOptions(aOptions), mMemoryResource(aMemoryResource)
+    {
+    }
+
+    [[nodiscard]] constexpr bool Has(const Option aOption) const noexcept
+    {
+        return static_cast<uint8_t>(mOptions) & static_cast<uint8_t>(aOption);
+    }
+
+    [[nodiscard]] constexpr std::pmr::memory_resource *GetMemoryResource() const noexcept
+    {
+        return mMemoryResource;
+    }
+
+    constexpr StreamContext &SetLimits(const Limits &aLimits) noexcept
+    {
+        mLimits = aLimits;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr const Limits &GetLimits() const noexcept
+    {
+        return mLimits;
+    }
+
+    // forgets the state of the last serialization/deserialization, the options are kept
+    void Clear() noexcept
+    {
+        mIdentitiesWritten.clear();
+        mIdentitiesWrittenCount = 0;
+        mIdentitiesRead.clear();
+
+        mStatus = Status::OK;
+        mStatusPosition = nullptr;
+
+        mAllocated = 0;
+        mDepth = 0;
+    }
+
+  private:
+    friend class StreamWriter;
+    friend class StreamReader;
+    friend class IStreamable;
+
+    Option mOptions = Option::NONE;
+    std::pmr::memory_resource *mMemoryResource{};
+
+    Limits mLimits{};
+    Size::size_max mAllocated{};
+    Size::size_max mDepth{};
+
+    // the identities start from 1, 0 being written before objects written for the first time
+    std::unordered_map<const void *, std::pair<Size::size_max, const std::type_info *>> mIdentitiesWritten;
+    Size::size_max mIdentitiesWrittenCount{};
+    // the objects read are kept with their type, so a back reference can't alias an object of another type
+    std::vector<std::pair<std::shared_ptr<void>, std::type_index>> mIdentitiesRead;
+
+    // the reader records the first error instead of throwing it
+    bool mThrows = true;
+    Status mStatus = Status::OK;
+    const uint8_t *mStatusPosition{};
+
+    constexpr void Fail(const Status aStatus, const uint8_t *aPosition) noexcept
+    {
+        if (mStatus == Status::OK)
+        {
+            mStatus = aStatus;
+            mStatusPosition = aPosition;
+        }
+    }
+};
+
+[[nodiscard]] constexpr StreamContext::Option operator|(const StreamContext::Option aLeft,
+                                                        const StreamContext::Option aRight) noexcept
+{
+    return static_cast<StreamContext::Option>(static_cast<uint8_t>(aLeft) | static_cast<uint8_t>(aRight));
+}
+} // namespace hbann
@@ -9,6 +9,7 @@
 #include "Stream.h"
 #include "Utilities/Converter.h"
 #include "Utilities/SizeFinder.h"
+#include "Utilities/Tag.h"
 
 namespace hbann
 {
@@ -28,22 +29,185 @@ class StreamReader
         *this = std::move(aStreamReader);
     }
 
-    template <typename Type, typename... Types> constexpr void ReadAll(Type &aObject, Types &...aObjects)
+    template <typename Type, typename... Types> constexpr void ReadAll(Type &&aObject, Types &&...aObjects)
     {
         using TypeRaw = std::remove_cvref_t<Type>;
 
+        Begin();
+
+        // consecutive objects of known size are read with a single bounds check and copy, that can't be made at
+        // compile time, an older stream may end inside the run too, then the objects are read one by one
+        if constexpr (constexpr auto run = SizeFinder::FindKnownSizeRun<Type, Types...>(); run > 1)
+        {
+            auto objects = std::tie(aObject, aObjects...);
+            if (!std::is_constant_evaluated() && ReadKnownSizeRun(objects, std::make_index_sequence<run>{}))
+            {
+                [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                    ReadAll(std::get<run + vIndexes>(objects)...);
+                }(std::make_index_sequence<sizeof...(Types) + 1 - run>{});
+
+                return;
+            }
+        }
+
         Read<TypeRaw>(aObject);
 
         if constexpr (sizeof...(aObjects))
         {
-            ReadAll<Types...>(aObjects...);
+            ReadAll(aObjects...);
+        }
+    }
+
+    // reads the objects written by StreamWriter::WriteTagged in any order, the unknown ones are skipped
+    template <size_t vCount, typename... Types>
+    constexpr void ReadTagged(const std::array<Tag::id, vCount> &aIds, Types &...aObjects)
+    {
+        static_assert(vCount == sizeof...(Types), "There must be an id for every object!");
+
+        Begin();
+
+        const auto count = ReadCount();
+        if (!CanReadCount(count, sizeof(uint8_t)))
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto key = ReadCount();
+            const auto id = Tag::GetId(key);
+            const auto kind = Tag::GetKind(key);
+
+            size_t index{};
+            if (!((aIds[index] == id ? (ReadTaggedObject(kind, aObjects), true) : (index++, false)) || ...))
+            {
+                SkipTaggedObject(kind);
+            }
+        }
+    }
+
+    // reads the objects written by StreamWriter::WriteSparse, the present optionals are read in place
+    template <typename... Types> constexpr void ReadSparse(Types &...aObjects)
+    {
+        Begin();
+
+        std::array<uint8_t, (SizeFinder::FindOptionalCount<Types...>() + 7) / 8> presence{};
+
+        // the objects were not written by an older version
+        if (!mStream->CanRead(presence.size()))
+        {
+            if (mStream->Remaining())
+            {
+                Fail(StreamContext::Status::TRUNCATED, "Truncated presence bitmap!");
+            }
+
+            return;
+        }
+
+        std::ranges::copy(mStream->Read(presence.size()), presence.begin());
+
+        size_t index{};
+        (
+            [&] {
+                if constexpr (is_optional_v<Types>)
+                {
+                    if (!(presence[index / 8] >> index % 8 & 1))
+                    {
+                        aObjects.reset();
+                    }
+                    else
+                    {
+                        if (!aObjects)
+                        {
+                            aObjects.emplace();
+                        }
+
+                        Read(*aObjects);
+                    }
+
+                    index++;
+                }
+                else
+                {
+                    Read(aObjects);
+                }
+            }(),
+            ...);
+    }
+
+    // applies the fields written by StreamWriter::WriteDelta to aObject, that must be like the baseline they were
+    // compared with, the other fields are left untouched
+    template <typename Type> constexpr void ReadDelta(Type &aObject)
+    {
+        Begin();
+
+        auto fields = Reflector::TieFields(aObject);
+        constexpr auto count = std::tuple_size_v<decltype(fields)>;
+
+        std::array<uint8_t, (count + 7) / 8> changed{};
+        if (!mStream->CanRead(changed.size()))
+        {
+            Fail(StreamContext::Status::TRUNCATED, "Truncated delta bitmap!");
+            return;
         }
+
+        std::ranges::copy(mStream->Read(changed.size()), changed.begin());
+
+        [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+            ((changed[vIndexes / 8] >> vIndexes % 8 & 1 ? (void)ReadDeltaObject(std::get<vIndexes>(fields)) : void()),
+             ...);
+        }(std::make_index_sequence<count>{});
+    }
+
+    // reads an object written by StreamWriter::WriteArray, at compile time too
+    template <typename Type, size_t vSize>
+    [[nodiscard]] static constexpr Type ReadArray(const std::array<uint8_t, vSize> &aBytes)
+    {
+        Stream stream(aBytes);
+
+        Type object{};
+        StreamReader(stream).ReadAll(object);
+
+        return object;
     }
 
     constexpr void ReadAll()
     {
     }
 
+    // a range is written as its count followed by its elements, so they can be decoded one by one without building
+    // the range itself (reads any range whose elements are of type Type)
+    template <typename Type, typename Function>
+        requires std::invocable<Function, Type &&>
+    constexpr decltype(auto) ReadEach(Function &&aFunction)
+    {
+        Begin();
+
+        const auto count = ReadCount();
+        if (!CanReadCount(count, SizeFinder::FindMinSize<Type>()) ||
+            (count && !Align(SizeFinder::FindAlignment<Type>())))
+        {
+            return *this;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            Type object{};
+            Read(object);
+            std::invoke(aFunction, std::move(object));
+        }
+
+        return *this;
+    }
+
+    template <typename Type, std::output_iterator<Type> Iterator>
+        requires(!std::invocable<Iterator, Type &&>)
+    constexpr Iterator ReadEach(Iterator aIterator)
+    {
+        ReadEach<Type>([&](Type &&aObject) { *aIterator++ = std::move(aObject); });
+        return aIterator;
+    }
+
     template <typename FunctionSeek>
     constexpr decltype(auto) Peek(FunctionSeek &&aFunctionSeek, const Size::size_max aOffset = 0)
     {
@@ -70,7 +234,7 @@ class StreamReader
     {
         if constexpr (is_optional_v<Type>)
         {
-            return ReadOptional(aObject);
+            return ReadNested([&] { ReadOptional(aObject); });
         }
         else if constexpr (is_variant_v<Type>)
         {
@@ -87,10 +251,44 @@ class StreamReader
             auto &first = const_cast<std::remove_const_t<typename Type::first_type> &>(aObject.first);
             return ReadAll(first, aObject.second);
         }
+        else if constexpr (is_shaped<Type>)
+        {
+            return ReadShaped(aObject);
+        }
+        else if constexpr (is_columnar_v<Type>)
+        {
+            return ReadColumnar(aObject);
+        }
+        else if constexpr (is_fixed_array<Type>)
+        {
+            return ReadFixedArray(aObject);
+        }
+        else if constexpr (is_span_v<Type>)
+        {
+            return ReadSpan(aObject);
+        }
+        else if constexpr (has_streamable_fields<Type>)
+        {
+            // the fields are read one after another, without a size in bytes like streamables
+            return ReadNested(
+                [&] { std::apply([&](auto &&...aArgs) { ReadAll(aArgs...); }, StreamableFields(aObject)); });
+        }
+        else if constexpr (is_reflectable<Type>)
+        {
+            return ReadNested(
+                [&] { std::apply([&](auto &&...aArgs) { ReadAll(aArgs...); }, Reflector::Tie(aObject)); });
+        }
         else if constexpr (std::ranges::range<Type>)
         {
-            aObject = std::move(ReadRange<Type>());
-            return *this;
+            // the ranges of objects of known size can't hold themselves
+            if constexpr (is_known_size<range_value_t<Type>>)
+            {
+                return ReadRange(aObject);
+            }
+            else
+            {
+                return ReadNested([&] { ReadRange(aObject); });
+            }
         }
         else if constexpr (std::derived_from<Type, IStreamable>)
         {
@@ -98,7 +296,7 @@ class StreamReader
         }
         else if constexpr (is_any_pointer<Type>)
         {
-            return ReadPointer(aObject);
+            return ReadNested([&] { ReadPointer(aObject); });
         }
         else if constexpr (is_standard_layout_no_pointer<Type>)
         {
@@ -114,64 +312,151 @@ class StreamReader
     {
         static_assert(is_optional_v<Type>, "Type is not an optional!");
 
-        using TypeValueType = typename Type::value_type;
+        if (!ReadCount())
+        {
+            aOpt.reset();
+            return *this;
+        }
 
-        if (ReadCount())
+        // read into the existing value so it keeps its capacity
+        if (!aOpt.has_value())
         {
-            TypeValueType obj{};
-            Read(obj);
-            aOpt = std::move(obj);
+            aOpt.emplace();
         }
 
-        return *this;
+        return Read(*aOpt);
     }
 
     template <typename Type> constexpr decltype(auto) ReadVariant(Type &aVariant)
     {
         static_assert(is_variant_v<Type>, "Type is not a variant!");
 
-        aVariant = variant_from_index<Type>(ReadCount());
-        std::visit([&](auto &&aArg) { Read(aArg); }, aVariant);
+        return ReadVariantIndex(aVariant, ReadCount(), std::make_index_sequence<std::variant_size_v<Type>>{});
+    }
+
+    template <typename Type, size_t... vIndexes>
+    constexpr decltype(auto) ReadVariantIndex(Type &aVariant, const Size::size_max aIndex,
+                                              const std::index_sequence<vIndexes...>)
+    {
+        constexpr std::array<void (StreamReader::*)(Type &), sizeof...(vIndexes)> reads{
+            &StreamReader::ReadVariantAs<Type, vIndexes>...};
+        if (aIndex >= reads.size())
+        {
+            Fail(StreamContext::Status::INVALID_INDEX, "Out of bounds variant index!");
+            return *this;
+        }
 
+        (this->*reads[aIndex])(aVariant);
         return *this;
     }
 
+    template <typename Type, size_t vIndex> constexpr void ReadVariantAs(Type &aVariant)
+    {
+        // the alternative is constructed only if it's not the one we already hold
+        if (aVariant.index() != vIndex)
+        {
+            aVariant.template emplace<vIndex>();
+        }
+
+        Read(std::get<vIndex>(aVariant));
+    }
+
     template <typename Type> constexpr decltype(auto) ReadPointer(Type &aPointer)
     {
         static_assert(is_any_pointer<Type>, "Type is not a smart/raw pointer!");
 
-        if constexpr (is_unique_ptr_v<Type>)
-        {
-            aPointer = std::make_unique<typename Type::element_type>();
-        }
-        else if constexpr (is_shared_ptr_v<Type>)
+        // shared objects are read only once, later they are read as a reference to the first one
+        if constexpr (is_shared_ptr_v<Type>)
         {
-            aPointer = std::make_shared<typename Type::element_type>();
+            const auto context = mStream->GetContext();
+            if (context && context->Has(StreamContext::Option::IDENTITY))
+            {
+                return ReadShared(aPointer, context->mIdentitiesRead);
+            }
         }
-        else if constexpr (!is_derived_from_pointer<Type, IStreamable>)
+
+        return ReadPointerObject(aPointer);
+    }
+
+    template <typename Type>
+    constexpr decltype(auto) ReadShared(Type &aPointer,
+                                        std::vector<std::pair<std::shared_ptr<void>, std::type_index>> &aIdentities)
+    {
+        static_assert(is_shared_ptr_v<Type>, "Type is not a shared pointer!");
+
+        if (const auto identity = ReadCount())
         {
-            // raw pointers MUST be allocated only for non streamables
-            aPointer = new std::remove_pointer_t<Type>;
+            if (identity > aIdentities.size())
+            {
+                Fail(StreamContext::Status::INVALID_INDEX, "Out of bounds shared pointer identity!");
+                return *this;
+            }
+
+            // the writer references only objects written through pointers of the same type
+            const auto &[object, type] = aIdentities[identity - 1];
+            if (type != typeid(typename Type::element_type))
+            {
+                Fail(StreamContext::Status::INVALID_INDEX, "Shared pointer identity of another type!");
+                return *this;
+            }
+
+            aPointer = std::static_pointer_cast<typename Type::element_type>(object);
+            return *this;
         }
 
-        // we treat pointers to streamable in a special way
+        // the identity is taken before reading the object to match the order of the writer
+        const auto identity = aIdentities.size();
+        aIdentities.emplace_back(nullptr, typeid(typename Type::element_type));
+
+        ReadPointerObject(aPointer);
+        aIdentities[identity].first = aPointer;
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadPointerObject(Type &aPointer)
+    {
+        // we treat pointers to streamable in a special way, they allocate the derived class themselves
         if constexpr (is_derived_from_pointer<Type, IStreamable>)
         {
             return ReadStreamablePtr(aPointer);
         }
         else
         {
+            New<Type, typename std::pointer_traits<Type>::element_type>(aPointer);
             return Read(*aPointer);
         }
     }
 
-    template <typename Type> constexpr decltype(auto) ReadStreamable(Type &aStreamable)
+    template <typename Type, bool vPolymorphic = false> constexpr decltype(auto) ReadStreamable(Type &aStreamable)
     {
         static_assert(std::derived_from<Type, IStreamable>, "Type is not a streamable!");
 
-        aStreamable.Deserialize(static_cast<Stream>(mStream->Read(ReadCount())),
-                                false); // read streamable size in bytes
-        return *this;
+        const auto size = ReadCount(); // read streamable size in bytes
+        if (!Align(ALIGNMENT_MAX) || !CanReadCount(size, sizeof(uint8_t)))
+        {
+            return *this;
+        }
+
+        return ReadNested([&] {
+            // nested streamables share our context and are not deserialized from scratch
+            aStreamable.Invalidate();
+            aStreamable.Swap(mStream->ReadStream(size));
+
+            // a pointed object or one seen through a reference to its base needs the virtual call
+            if constexpr (vPolymorphic || std::is_abstract_v<Type>)
+            {
+                aStreamable.FromStream();
+            }
+            else if (std::is_final_v<Type> || typeid(aStreamable) == typeid(Type))
+            {
+                aStreamable.Type::FromStream();
+            }
+            else
+            {
+                aStreamable.FromStream();
+            }
+        });
     }
 
     template <typename Type> constexpr decltype(auto) ReadStreamablePtr(Type &aStreamablePtr)
@@ -181,57 +466,369 @@ class StreamReader
         using TypeNoPtr = std::conditional_t<std::is_pointer_v<Type>, std::remove_pointer_t<Type>,
                                              typename std::pointer_traits<Type>::element_type>;
 
-        // we cannot use the has_method_find_derived_streamable concept because we must use the context of the
-        // StreamReader that is a friend of streamables
-        static_assert(
-            requires(StreamReader &aStreamReader) {
+        // registered derived classes are prefixed by their index so we can allocate and read them in a single pass
+        if constexpr (has_streamable_derived<TypeNoPtr>)
+        {
+            using TypeDerived = std::type_identity<typename TypeNoPtr::StreamableDerived>;
+            NewDerived(aStreamablePtr, ReadCount(), TypeDerived{});
+        }
+        else
+        {
+            // we cannot use the has_method_find_derived_streamable concept because we must use the context of the
+            // StreamReader that is a friend of streamables
+            static_assert(
+                requires(StreamReader &aStreamReader) {
+                    {
+                        TypeNoPtr::FindDerivedStreamable(aStreamReader)
+                    } -> std::convertible_to<IStreamable *>;
+                }, "Type doesn't have a public/protected method 'static "
+                   "IStreamable* FindDerivedStreamable(StreamReader &)' !");
+
+            Peek([&](auto) {
+                const auto size = ReadCount(); // read streamable size in bytes
+                if (!Align(ALIGNMENT_MAX) || !CanReadCount(size, sizeof(uint8_t)))
+                {
+                    return;
+                }
+
+                // the factory reads with our context, so its errors follow the limits and the throwing mode too
+                auto stream = mStream->ReadStream(size);
+                StreamReader streamReader(stream);
+
+                // TODO: we let the user read n objects after wich we read again... fix it
+                if constexpr (is_smart_pointer<Type>)
                 {
-                    TypeNoPtr::FindDerivedStreamable(aStreamReader)
-                } -> std::convertible_to<IStreamable *>;
-            }, "Type doesn't have a public/protected method 'static "
-               "IStreamable* FindDerivedStreamable(StreamReader &)' !");
+                    aStreamablePtr.reset(static_cast<TypeNoPtr *>(TypeNoPtr::FindDerivedStreamable(streamReader)));
+                }
+                else
+                {
+                    aStreamablePtr = dynamic_cast<TypeNoPtr *>(TypeNoPtr::FindDerivedStreamable(streamReader));
+                }
+            });
+
+            // the factory failed without throwing, nothing after it can be read right
+            if (const auto context = mStream->GetContext(); context && context->mStatus != StreamContext::Status::OK)
+            {
+                mStream->Skip();
+                return *this;
+            }
+        }
+
+        // the derived streamable is not known, it's skipped so the objects after it are read from the right offset
+        if (!aStreamablePtr)
+        {
+            const auto size = ReadCount();
+            if (Align(ALIGNMENT_MAX) && CanReadCount(size, sizeof(uint8_t)))
+            {
+                [[maybe_unused]] const auto view = mStream->Read(size);
+            }
 
-        Peek([&](auto) {
-            Stream stream(mStream->Read(ReadCount())); // read streamable size in bytes
-            StreamReader streamReader(stream);
+            return *this;
+        }
+
+        return ReadStreamable<TypeNoPtr, true>(*aStreamablePtr);
+    }
+
+    template <typename Type, typename... Types>
+    constexpr decltype(auto) NewDerived(Type &aPointer, const Size::size_max aIndex,
+                                        const std::type_identity<std::tuple<Types...>>)
+    {
+        static_assert(sizeof...(Types), "There are no registered derived streamables!");
+
+        using TypeNoPtr = typename std::pointer_traits<Type>::element_type;
+
+        constexpr std::array<void (StreamReader::*)(Type &), sizeof...(Types)> news{
+            &StreamReader::NewDerivedAs<Type, TypeNoPtr, Types>...};
+        if (aIndex >= news.size())
+        {
+            Fail(StreamContext::Status::INVALID_INDEX, "Out of bounds derived streamable index!");
+            return *this;
+        }
+
+        (this->*news[aIndex])(aPointer);
+        return *this;
+    }
 
-            // TODO: we let the user read n objects after wich we read again... fix it
-            if constexpr (is_smart_pointer<Type>)
+    template <typename Type, typename TypeNoPtr, typename TypeDerived> constexpr void NewDerivedAs(Type &aPointer)
+    {
+        // derived classes inherit the registered classes of their bases, not all of them are derived from them
+        if constexpr (std::derived_from<TypeDerived, TypeNoPtr>)
+        {
+            New<Type, TypeDerived>(aPointer);
+        }
+        else
+        {
+            Fail(StreamContext::Status::INVALID_INDEX, "Derived streamable index of a class that is not derived!");
+        }
+    }
+
+    template <typename Type, typename TypeObject> constexpr decltype(auto) New(Type &aPointer)
+    {
+        static_assert(is_any_pointer<Type>, "Type is not a smart/raw pointer!");
+
+        if (!CanAllocate(1, sizeof(TypeObject)))
+        {
+            return *this;
+        }
+
+        const auto context = mStream->GetContext();
+        const auto memoryResource = context ? context->GetMemoryResource() : nullptr;
+
+        // raw pointers are deleted by their owner, so they never come from the memory resource
+        if (!memoryResource || std::is_pointer_v<Type>)
+        {
+            if constexpr (is_shared_ptr_v<Type>)
             {
-                aStreamablePtr.reset(static_cast<TypeNoPtr *>(TypeNoPtr::FindDerivedStreamable(streamReader)));
+                aPointer = std::make_shared<TypeObject>();
+            }
+            else if constexpr (is_unique_ptr_v<Type>)
+            {
+                aPointer = Type(new TypeObject);
             }
             else
             {
-                aStreamablePtr = dynamic_cast<TypeNoPtr *>(TypeNoPtr::FindDerivedStreamable(streamReader));
+                aPointer = new TypeObject;
             }
-        });
 
-        aStreamablePtr->Deserialize(static_cast<Stream>(mStream->Read(ReadCount())), false);
+            return *this;
+        }
+
+        std::pmr::polymorphic_allocator<TypeObject> allocator(memoryResource);
+        if constexpr (is_shared_ptr_v<Type>)
+        {
+            // the control block is allocated together with the object
+            aPointer = std::allocate_shared<TypeObject>(allocator);
+        }
+        else if constexpr (is_unique_ptr_v<Type>)
+        {
+            using TypeDeleter = typename Type::deleter_type;
+
+            // only our deleter knows how to give the object back to the memory resource
+            if constexpr (std::is_same_v<TypeDeleter, Deleter<typename Type::element_type>>)
+            {
+                const TypeDeleter deleter(memoryResource, sizeof(TypeObject), alignof(TypeObject));
+                aPointer = Type(allocator.template new_object<TypeObject>(), deleter);
+            }
+            else
+            {
+                aPointer = Type(new TypeObject);
+            }
+        }
+
         return *this;
     }
 
-    template <typename Type> [[nodiscard]] constexpr Type ReadRange()
+    template <typename Type> constexpr decltype(auto) ReadFixedArray(Type &aRange)
     {
-        static_assert(std::ranges::range<Type>, "Type is not a range!");
+        static_assert(is_fixed_array<Type>, "Type is not an array!");
 
+        if constexpr (is_known_size<Type>)
+        {
+            ReadObjectOfKnownSize(aRange);
+        }
+        else
+        {
+            for (auto &object : aRange)
+            {
+                Read(object);
+            }
+        }
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadShaped(Type &aShaped)
+    {
+        static_assert(is_shaped<Type>, "Type is not a dense or rectangular array!");
+
+        typename Type::shape_type shape{};
+        std::ranges::generate(shape, [&] { return ReadCount(); });
+
+        if (!Align(SizeFinder::FindAlignment<typename Type::value_type>()))
+        {
+            return *this;
+        }
+
+        // the product of the extents can't overflow, the rows of a rectangular range are allocated even when they are
+        // empty so they are counted apart
+        constexpr auto max = std::numeric_limits<Size::size_max>::max();
+        Size::size_max count{1}, countRows{};
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            if ((shape[i] && count > max / shape[i]) || (i + 1 < shape.size() && countRows > max - count * shape[i]))
+            {
+                Fail(StreamContext::Status::INVALID_COUNT, "Shape out of the stream bounds!");
+                return *this;
+            }
+
+            count *= shape[i];
+            countRows += i + 1 < shape.size() ? count : 0;
+        }
+
+        if (!CanReadCount(count, sizeof(typename Type::value_type)) ||
+            !CanAllocate(count, sizeof(typename Type::value_type)))
+        {
+            return *this;
+        }
+
+        if constexpr (is_rectangular_v<Type>)
+        {
+            if (!CanAllocate(countRows, sizeof(range_value_t<typename Type::range_type>)))
+            {
+                return *this;
+            }
+        }
+
+        aShaped.Reshape(shape);
+
+        // the elements are read in a single block in a dense array and in a block per row in a rectangular range
+        const auto ReadElements = [&](const auto aElements) {
+            if (aElements.empty())
+            {
+                return;
+            }
+
+            std::memcpy(aElements.data(), mStream->Read(aElements.size_bytes()).data(), aElements.size_bytes());
+        };
+
+        if constexpr (is_dense_v<Type>)
+        {
+            ReadElements(aShaped.GetElements());
+        }
+        else
+        {
+            aShaped.ForEachRow([&](auto &aRow) { ReadElements(std::span(aRow)); });
+        }
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadColumnar(Type &aColumnar)
+    {
+        static_assert(is_columnar_v<Type>, "Type is not a columnar range!");
+
+        const auto count = ReadCount();
+        if (!CanReadCount(count, Type::FindMinSize()) || !CanAllocate(count, Type::FindRecordSize()))
+        {
+            return *this;
+        }
+
+        aColumnar.Resize(count);
+
+        aColumnar.ForEachColumn([&](auto &&aColumn) {
+            using TypeColumn = std::remove_cvref_t<decltype(aColumn)>;
+
+            if (!Align(SizeFinder::FindRangeAlignment<TypeColumn>()))
+            {
+                return;
+            }
+
+            if constexpr (std::ranges::contiguous_range<TypeColumn> && is_known_size<range_value_t<TypeColumn>>)
+            {
+                // the columns before may have been bigger than their minimum
+                const auto column = std::span(aColumn);
+                if (column.empty() || !CanReadCount(column.size(), sizeof(range_value_t<TypeColumn>)))
+                {
+                    return;
+                }
+
+                std::memcpy(column.data(), mStream->Read(column.size_bytes()).data(), column.size_bytes());
+            }
+            else
+            {
+                for (auto &&object : aColumn)
+                {
+                    Read(object);
+                }
+            }
+        });
+
+        return *this;
+    }
+
+    // the span points to the elements in the stream, they must be aligned, so the stream must outlive it
+    template <typename Type> constexpr decltype(auto) ReadSpan(Type &aSpan)
+    {
         using TypeValueType = typename Type::value_type;
 
-        Type range{};
+        static_assert(Type::extent == std::dynamic_extent && std::is_const_v<typename Type::element_type> &&
+                          is_known_size<TypeValueType>,
+                      "Only spans of dynamic extent of const objects of known size can be read!");
+
+        aSpan = {};
+
         const auto count = ReadCount();
+        if (!count || !Align(SizeFinder::FindAlignment<TypeValueType>()) ||
+            !CanReadCount(count, sizeof(TypeValueType)))
+        {
+            return *this;
+        }
+
+        if (reinterpret_cast<std::uintptr_t>(mStream->Position()) % alignof(TypeValueType))
+        {
+            Fail(StreamContext::Status::MISALIGNED, "The elements of the span are not aligned!");
+            return *this;
+        }
+
+        const auto elementsPtr = mStream->Read(count * sizeof(TypeValueType)).data();
+        aSpan = Type(reinterpret_cast<const TypeValueType *>(elementsPtr), count);
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadRange(Type &aRange)
+    {
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        const auto count = ReadCount();
+        if (!CanReadRange<Type>(count) || (count && !Align(SizeFinder::FindRangeAlignment<Type>())))
+        {
+            return *this;
+        }
 
         if constexpr (SizeFinder::FindRangeRank<Type>() > 1)
         {
-            for (size_t i = 0; i < count; i++)
+            ReadRangeElements(aRange, count, [&](auto &aObject) { ReadRange(aObject); });
+        }
+        else
+        {
+            ReadRangeRank1(aRange, count);
+        }
+
+        return *this;
+    }
+
+    template <typename Type, typename FunctionRead>
+    constexpr decltype(auto) ReadRangeElements(Type &aRange, const Size::size_max aCount, FunctionRead &&aFunctionRead)
+    {
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        using TypeValueType = typename Type::value_type;
+
+        // sequence containers are refilled in place, so the range and its elements keep their capacity
+        if constexpr (has_method_resize<Type>)
+        {
+            aRange.resize(aCount);
+
+            for (auto &object : aRange)
             {
-                range.insert(std::ranges::cend(range), ReadRange<TypeValueType>());
+                aFunctionRead(object);
             }
         }
         else
         {
-            ReadRangeRank1(range, count);
+            aRange.clear();
+            ReserveRange(aRange, aCount);
+
+            for (size_t i = 0; i < aCount; i++)
+            {
+                TypeValueType object{};
+                aFunctionRead(object);
+                InsertRange(aRange, std::move(object));
+            }
         }
 
-        return range;
+        return *this;
     }
 
     template <typename Type> constexpr decltype(auto) ReadPath(Type &aRange, const Size::size_max aCount)
@@ -255,10 +852,11 @@ class StreamReader
 
         if (!aCount)
         {
+            aRange.clear();
             return *this;
         }
 
-        if constexpr (is_utf16string<Type>)
+        if constexpr (is_wide_string<Type>)
         {
             aRange.assign(Converter::Decode<Type>(mStream->Read(aCount)));
         }
@@ -266,11 +864,22 @@ class StreamReader
         {
             ReadPath(aRange, aCount);
         }
+        else if (std::is_constant_evaluated())
+        {
+            aRange.clear();
+            for (size_t i = 0; i < aCount; i++)
+            {
+                TypeValueType object{};
+                ReadObjectOfKnownSize(object);
+                aRange.push_back(object);
+            }
+        }
         else
         {
+            // the elements may not be aligned in the stream, so they are copied instead of dereferenced
             const auto rangeView = mStream->Read(aCount * sizeof(TypeValueType));
-            const auto rangePtr = reinterpret_cast<const TypeValueType *>(rangeView.data());
-            aRange.assign(rangePtr, rangePtr + rangeView.size() / sizeof(TypeValueType));
+            aRange.resize(aCount);
+            std::memcpy(std::ranges::data(aRange), rangeView.data(), rangeView.size());
         }
 
         return *this;
@@ -280,41 +889,161 @@ class StreamReader
     {
         static_assert(std::ranges::range<Type>, "Type is not a range!");
 
-        using TypeValueType = typename Type::value_type;
-
         if constexpr (is_range_standard_layout<Type>)
         {
             ReadRangeStandardLayout(aRange, aCount);
         }
         else
         {
-            for (size_t i = 0; i < aCount; i++)
+            ReadRangeElements(aRange, aCount, [&](auto &aObject) { Read(aObject); });
+        }
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReserveRange(Type &aRange, const Size::size_max aCount)
+    {
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        // clamp to the bytes left so a corrupted count can't make us reserve more than the stream could ever fill
+        if constexpr (has_method_reserve<Type>)
+        {
+            aRange.reserve(std::min(aCount, mStream->Remaining()));
+        }
+
+        return *this;
+    }
+
+    template <typename Type, typename TypeValueType>
+    constexpr decltype(auto) InsertRange(Type &aRange, TypeValueType &&aObject)
+    {
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        // ordered containers were written in order, so hinting the end makes every insertion amortized O(1)
+        if constexpr (has_method_emplace_hint<Type>)
+        {
+            aRange.emplace_hint(std::ranges::cend(aRange), std::forward<TypeValueType>(aObject));
+        }
+        else
+        {
+            aRange.insert(std::ranges::cend(aRange), std::forward<TypeValueType>(aObject));
+        }
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadTaggedObject(const Tag::Kind aKind, Type &aObject)
+    {
+        // the type of the object changed, we can't read the old one
+        constexpr auto kind = Tag::FindKind<Type>();
+        if (aKind != kind)
+        {
+            return SkipTaggedObject(aKind);
+        }
+
+        if constexpr (kind == Tag::Kind::DELIMITED)
+        {
+            const auto size = ReadCount();
+            if (!Align(ALIGNMENT_MAX) || !CanReadCount(size, sizeof(uint8_t)))
             {
-                TypeValueType object{};
-                Read(object);
-                aRange.insert(std::ranges::cend(aRange), std::move(object));
+                return *this;
+            }
+
+            // the object can't read past its own bytes
+            auto stream = mStream->ReadStream(size);
+            StreamReader(stream).Read(aObject);
+        }
+        else
+        {
+            Read(aObject);
+        }
+
+        return *this;
+    }
+
+    constexpr decltype(auto) SkipTaggedObject(const Tag::Kind aKind)
+    {
+        Size::size_max size{};
+        if (aKind == Tag::Kind::DELIMITED)
+        {
+            size = ReadCount();
+            if (!Align(ALIGNMENT_MAX))
+            {
+                return *this;
             }
         }
+        else if (aKind < Tag::Kind::DELIMITED)
+        {
+            size = Tag::FindFixedSize(aKind);
+        }
+        else
+        {
+            Fail(StreamContext::Status::INVALID_INDEX, "Unknown tagged object kind!");
+            return *this;
+        }
+
+        if (CanReadCount(size, sizeof(uint8_t)))
+        {
+            [[maybe_unused]] const auto view = mStream->Read(size);
+        }
 
         return *this;
     }
 
+    template <typename Type, size_t... vIndexes>
+    [[nodiscard]] constexpr bool ReadKnownSizeRun(Type &aObjects, const std::index_sequence<vIndexes...>)
+    {
+        constexpr auto sizes = std::array{sizeof(std::remove_cvref_t<std::tuple_element_t<vIndexes, Type>>)...};
+        constexpr auto size = (sizes[vIndexes] + ...);
+
+        if (!mStream->CanRead(size))
+        {
+            return false;
+        }
+
+        auto bytesPtr = mStream->Read(size).data();
+        ((std::memcpy(&std::get<vIndexes>(aObjects), bytesPtr, sizes[vIndexes]), bytesPtr += sizes[vIndexes]), ...);
+
+        return true;
+    }
+
     template <typename Type> constexpr decltype(auto) ReadObjectOfKnownSize(Type &aObject)
     {
         static_assert(is_standard_layout_no_pointer<Type>, "Type is not an object of known size or it is a pointer!");
 
+        // a missing object was not written by an older version, but a part of one is an error
         if (!mStream->CanRead(sizeof(Type)))
         {
+            if (mStream->Remaining())
+            {
+                Fail(StreamContext::Status::TRUNCATED, "Truncated object!");
+            }
+
             return *this;
         }
 
         const auto view = mStream->Read(sizeof(Type));
-        aObject = *reinterpret_cast<const Type *>(view.data());
+
+        // the bytes of an object can't be reinterpreted at compile time, but they can be copied
+        if constexpr (std::is_trivially_copyable_v<Type> && !std::is_array_v<Type>)
+        {
+            if (std::is_constant_evaluated())
+            {
+                std::array<uint8_t, sizeof(Type)> bytes{};
+                std::ranges::copy(view, bytes.begin());
+
+                aObject = std::bit_cast<Type>(bytes);
+                return *this;
+            }
+        }
+
+        // the object may not be aligned in the stream, so it's copied instead of dereferenced
+        std::memcpy(static_cast<void *>(&aObject), view.data(), sizeof(Type));
 
         return *this;
     }
 
-    inline Size::size_max ReadCount() noexcept
+    constexpr Size::size_max ReadCount()
     {
         if (!mStream->CanRead(1))
         {
@@ -324,10 +1053,189 @@ class StreamReader
         const auto size = Size::FindRequiredBytes(mStream->Current());
         if (!mStream->CanRead(size))
         {
+            Fail(StreamContext::Status::TRUNCATED, "Truncated count!");
             return 0;
         }
 
         return Size::MakeSize(mStream->Read(size));
     }
+
+    // skips the padding of aligned streams, the objects start at aAlignment from the start of the stream
+    constexpr bool Align(const size_t aAlignment)
+    {
+        const auto context = mStream->GetContext();
+        if (!context || !context->Has(StreamContext::Option::ALIGNED))
+        {
+            return true;
+        }
+
+        const auto offset = static_cast<size_t>(mStream->Position() - mStream->View().data());
+        const auto padding = (aAlignment - offset % aAlignment) % aAlignment;
+
+        // a missing object was not written by an older version, but a part of one is an error
+        if (!mStream->CanRead(padding))
+        {
+            if (mStream->Remaining())
+            {
+                Fail(StreamContext::Status::TRUNCATED, "Truncated padding!");
+            }
+
+            return false;
+        }
+
+        [[maybe_unused]] const auto view = mStream->Read(padding);
+        return true;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadDeltaObject(Type &aObject)
+    {
+        if constexpr (is_patchable<Type>)
+        {
+            // the elements after the ones of the baseline are all written, so they bound the count
+            const auto count = ReadCount();
+            const auto countChanged = ReadCount();
+            if (!CanReadCount(countChanged, sizeof(uint8_t) + SizeFinder::FindMinSize<range_value_t<Type>>()))
+            {
+                return *this;
+            }
+
+            if (count > std::ranges::size(aObject) + countChanged)
+            {
+                Fail(StreamContext::Status::INVALID_COUNT, "Delta count over the written elements!");
+                return *this;
+            }
+
+            if (!CanAllocate(count, sizeof(range_value_t<Type>)))
+            {
+                return *this;
+            }
+
+            aObject.resize(count);
+
+            for (size_t i = 0; i < countChanged; i++)
+            {
+                const auto index = ReadCount();
+                if (index >= count)
+                {
+                    Fail(StreamContext::Status::INVALID_INDEX, "Out of bounds delta element index!");
+                    return *this;
+                }
+
+                Read(aObject[index]);
+            }
+
+            return *this;
+        }
+        else
+        {
+            return Read(aObject);
+        }
+    }
+
+    // the objects that can hold objects of their own type (through ranges, optionals, pointers, fields or streamables)
+    // are counted against the depth limit, so a hostile stream can't recurse without bound
+    template <typename Function> constexpr decltype(auto) ReadNested(Function &&aFunction)
+    {
+        const auto context = mStream->GetContext();
+        if (!context)
+        {
+            aFunction();
+            return *this;
+        }
+
+        if (context->mDepth++ == context->mLimits.depth)
+        {
+            context->mDepth--;
+
+            Fail(StreamContext::Status::OVER_LIMIT, "Objects nested deeper than the limit!");
+            return *this;
+        }
+
+        try
+        {
+            aFunction();
+        }
+        catch (...)
+        {
+            context->mDepth--;
+            throw;
+        }
+
+        context->mDepth--;
+        return *this;
+    }
+
+    // reading from the start of a stream that is not nested is a new deserialization, so the budget of the context
+    // is spent again (ex.: a context reused by many readers)
+    constexpr void Begin() noexcept
+    {
+        const auto context = mStream->GetContext();
+        if (context && !context->mDepth && mStream->Position() == mStream->View().data())
+        {
+            context->mAllocated = 0;
+        }
+    }
+
+    // a count of objects of at least aSize bytes each can't ask for more bytes than there are left
+    [[nodiscard]] constexpr bool CanReadCount(const Size::size_max aCount, const Size::size_max aSize)
+    {
+        if (!aSize || aCount <= mStream->Remaining() / aSize)
+        {
+            return true;
+        }
+
+        Fail(StreamContext::Status::INVALID_COUNT, "Count out of the stream bounds!");
+        return false;
+    }
+
+    template <typename Type> [[nodiscard]] constexpr bool CanReadRange(const Size::size_max aCount)
+    {
+        using TypeValueType = range_value_t<Type>;
+
+        // the count of encoded strings is in bytes
+        if constexpr (is_wide_string<Type> || is_path<Type>)
+        {
+            return CanReadCount(aCount, sizeof(uint8_t)) && CanAllocate(aCount, sizeof(uint8_t));
+        }
+        else
+        {
+            return CanReadCount(aCount, SizeFinder::FindMinSize<TypeValueType>()) &&
+                   CanAllocate(aCount, sizeof(TypeValueType));
+        }
+    }
+
+    // the objects allocated by the reader are counted against the limits of the context
+    [[nodiscard]] constexpr bool CanAllocate(const Size::size_max aCount, const Size::size_max aSize)
+    {
+        const auto context = mStream->GetContext();
+        if (!context)
+        {
+            return true;
+        }
+
+        const auto &limits = context->mLimits;
+        if (aCount > limits.count || context->mAllocated > limits.bytes ||
+            aCount > (limits.bytes - context->mAllocated) / aSize)
+        {
+            Fail(StreamContext::Status::OVER_LIMIT, "Allocation over the limit!");
+            return false;
+        }
+
+        context->mAllocated += aCount * aSize;
+        return true;
+    }
+
+    // throws the error or, when deserializing without exceptions, records it in the context and stops reading
+    constexpr void Fail(const StreamContext::Status aStatus, const char *aMessage)
+    {
+        const auto context = mStream->GetContext();
+        if (!context || context->mThrows)
+        {
+            throw std::out_of_range(aMessage);
+        }
+
+        context->Fail(aStatus, mStream->Position());
+        mStream->Skip();
+    }
 };
 } // namespace hbann
@@ -9,6 +9,7 @@
 #include "Stream.h"
 #include "Utilities/Converter.h"
 #include "Utilities/SizeFinder.h"
+#include "Utilities/Tag.h"
 
 namespace hbann
 {
@@ -28,18 +29,126 @@ class StreamWriter
         *this = std::move(aStreamWriter);
     }
 
-    template <typename Type, typename... Types> constexpr void WriteAll(Type &aObject, Types &...aObjects)
+    template <typename Type, typename... Types> constexpr void WriteAll(Type &&aObject, Types &&...aObjects)
     {
         using TypeRaw = std::remove_cvref_t<Type>;
 
+        // consecutive objects of known size are written with a single copy, that can't be made at compile time
+        if constexpr (constexpr auto run = SizeFinder::FindKnownSizeRun<Type, Types...>(); run > 1)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto objects = std::forward_as_tuple(aObject, aObjects...);
+
+                WriteKnownSizeRun(objects, std::make_index_sequence<run>{});
+                [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                    WriteAll(std::get<run + vIndexes>(objects)...);
+                }(std::make_index_sequence<sizeof...(Types) + 1 - run>{});
+
+                return;
+            }
+        }
+
         Write<TypeRaw>(aObject);
 
         if constexpr (sizeof...(aObjects))
         {
-            WriteAll<Types...>(aObjects...);
+            WriteAll(std::forward<Types>(aObjects)...);
         }
     }
 
+    // every object is written with a key made of its id and its wire kind, so readers can skip the unknown ones
+    template <size_t vCount, typename... Types>
+    constexpr void WriteTagged(const std::array<Tag::id, vCount> &aIds, Types &...aObjects)
+    {
+        static_assert(vCount == sizeof...(Types), "There must be an id for every object!");
+
+        WriteCount(vCount);
+
+        size_t index{};
+        (WriteTaggedObject(aIds[index++], aObjects), ...);
+    }
+
+    // the optionals share a leading bitmap of their presence, instead of a count each, and only their values follow
+    template <typename... Types> constexpr void WriteSparse(Types &...aObjects)
+    {
+        std::array<uint8_t, (SizeFinder::FindOptionalCount<Types...>() + 7) / 8> presence{};
+
+        size_t index{};
+        (
+            [&] {
+                if constexpr (is_optional_v<Types>)
+                {
+                    presence[index / 8] |= static_cast<uint8_t>(aObjects.has_value() << index % 8);
+                    index++;
+                }
+            }(),
+            ...);
+
+        mStream->Write(presence);
+
+        (
+            [&] {
+                if constexpr (is_optional_v<Types>)
+                {
+                    if (aObjects)
+                    {
+                        Write(*aObjects);
+                    }
+                }
+                else
+                {
+                    Write(aObjects);
+                }
+            }(),
+            ...);
+    }
+
+    // writes a bitmap of the fields of aObject that differ from the fields of aBaseline followed by them, the patchable
+    // ranges as their count and the elements that differ, read by StreamReader::ReadDelta in an object like aBaseline
+    template <typename Type> constexpr void WriteDelta(Type &aObject, const Type &aBaseline)
+    {
+        // the baseline is only compared, it's cast for its streamables that are tied and written by non const methods
+        auto fields = Reflector::TieFields(aObject);
+        auto fieldsBaseline = Reflector::TieFields(const_cast<Type &>(aBaseline));
+        constexpr auto count = std::tuple_size_v<decltype(fields)>;
+
+        std::array<uint8_t, (count + 7) / 8> changed{};
+        [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+            ((changed[vIndexes / 8] |= static_cast<uint8_t>(
+                  !IsEqual(std::get<vIndexes>(fields), std::get<vIndexes>(fieldsBaseline)) << vIndexes % 8)),
+             ...);
+        }(std::make_index_sequence<count>{});
+
+        mStream->Write(changed);
+
+        [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+            ((changed[vIndexes / 8] >> vIndexes % 8 & 1
+                  ? (void)WriteDeltaObject(std::get<vIndexes>(fields), std::get<vIndexes>(fieldsBaseline))
+                  : void()),
+             ...);
+        }(std::make_index_sequence<count>{});
+    }
+
+    // writes the object returned by vFunction at compile time, the size of the array is found by writing it twice
+    template <auto vFunction> [[nodiscard]] static consteval auto WriteArray()
+    {
+        constexpr auto size = [] {
+            Stream stream;
+            StreamWriter(stream).WriteAll(vFunction());
+
+            return stream.View().size();
+        }();
+
+        Stream stream;
+        StreamWriter(stream).WriteAll(vFunction());
+
+        std::array<uint8_t, size> bytes{};
+        std::ranges::copy(stream.View(), bytes.begin());
+
+        return bytes;
+    }
+
     constexpr void WriteAll()
     {
     }
@@ -59,46 +168,508 @@ class StreamWriter
   private:
     Stream *mStream{};
 
+    template <typename Type> constexpr decltype(auto) WriteTaggedObject(const Tag::id aId, Type &aObject)
+    {
+        constexpr auto kind = Tag::FindKind<Type>();
+        WriteCount(Tag::MakeKey(aId, kind));
+
+        if constexpr (kind == Tag::Kind::DELIMITED)
+        {
+            // we find the size in bytes after writing the object, in aligned streams the object is written on its own
+            // so it starts aligned like a nested stream, inserting the size would move it
+            if (IsAligned())
+            {
+                Stream stream(*mStream->GetContext());
+                StreamWriter(stream).Write(aObject);
+
+                const auto streamView = stream.View();
+                WriteCount(streamView.size());
+                Align(ALIGNMENT_MAX);
+                mStream->Write(streamView);
+            }
+            else
+            {
+                const auto offset = mStream->View().size();
+                Write(aObject);
+                mStream->Insert(offset, Size::MakeSize(mStream->View().size() - offset));
+            }
+        }
+        else
+        {
+            Write(aObject);
+        }
+
+        return *this;
+    }
+
+    template <typename Type, size_t... vIndexes>
+    constexpr decltype(auto) WriteKnownSizeRun(Type &aObjects, const std::index_sequence<vIndexes...>)
+    {
+        constexpr auto sizes = std::array{sizeof(std::remove_cvref_t<std::tuple_element_t<vIndexes, Type>>)...};
+
+        // the objects are copied straight into the stream, a run of big arrays would not fit on the stack
+        const auto bytes = mStream->Extend((sizes[vIndexes] + ...));
+        auto bytesPtr = bytes;
+        ((std::memcpy(bytesPtr, &std::get<vIndexes>(aObjects), sizes[vIndexes]), bytesPtr += sizes[vIndexes]), ...);
+
+        if (IsCanonical())
+        {
+            bytesPtr = bytes;
+            ((CopyCanonical(std::get<vIndexes>(aObjects), bytesPtr), bytesPtr += sizes[vIndexes]), ...);
+        }
+
+        return *this;
+    }
+
     template <typename Type> constexpr decltype(auto) WriteObjectOfKnownSize(Type &aObject)
     {
         static_assert(is_standard_layout_no_pointer<Type>, "Type is not an object of known size or it is a pointer!");
 
-        const auto objectPtr = reinterpret_cast<uint8_t *>(&aObject);
-        mStream->Write({objectPtr, sizeof(aObject)});
+        // the bytes of an object can't be reinterpreted at compile time, but they can be copied
+        if constexpr (std::is_trivially_copyable_v<Type>)
+        {
+            if (std::is_constant_evaluated())
+            {
+                mStream->Write(std::bit_cast<std::array<uint8_t, sizeof(Type)>>(aObject));
+                return *this;
+            }
+        }
+
+        return WriteBlock(&aObject, 1);
+    }
+
+    // writes the bytes of the objects, in canonical streams their floating points are normalized and padding zeroed
+    template <typename Type> constexpr decltype(auto) WriteBlock(const Type *aObjects, const size_t aCount)
+    {
+        if constexpr (!std::has_unique_object_representations_v<Type>)
+        {
+            if (IsCanonical())
+            {
+                auto bytes = mStream->Extend(aCount * sizeof(Type));
+                for (size_t i = 0; i < aCount; i++, bytes += sizeof(Type))
+                {
+                    CopyCanonical(aObjects[i], bytes);
+                }
+
+                return *this;
+            }
+        }
 
+        mStream->Write({reinterpret_cast<const uint8_t *>(aObjects), aCount * sizeof(Type)});
         return *this;
     }
 
-    inline decltype(auto) WriteCount(const Size::size_max aSize)
+    /*
+        Copies the bytes of the object so equal objects have equal bytes: -0 is copied as 0, every NaN as the quiet
+        one and the padding of aggregates as 0, the other classes (and aggregates with C arrays) must not have padding
+        or floating points
+    */
+    template <typename Type> static constexpr void CopyCanonical(const Type &aObject, uint8_t *aBytes)
+    {
+        if constexpr (std::has_unique_object_representations_v<Type>)
+        {
+            std::memcpy(aBytes, &aObject, sizeof(Type));
+        }
+        else if constexpr (std::is_floating_point_v<Type>)
+        {
+            auto object = aObject;
+            if (std::isnan(object))
+            {
+                object = std::numeric_limits<Type>::quiet_NaN();
+            }
+            else if (object == Type{})
+            {
+                object = Type{};
+            }
+
+            std::memcpy(aBytes, &object, sizeof(Type));
+        }
+        else if constexpr (is_fixed_array<Type>)
+        {
+            for (auto &object : aObject)
+            {
+                CopyCanonical(object, aBytes);
+                aBytes += sizeof(object);
+            }
+        }
+        else if constexpr (is_bindable<Type> && detail::find_field_count<Type>() <= REFLECTABLE_FIELDS_MAX)
+        {
+            std::memset(aBytes, 0, sizeof(Type));
+            std::apply(
+                [&](auto &...aFields) {
+                    const auto objectPtr = reinterpret_cast<const uint8_t *>(&aObject);
+                    (CopyCanonical(aFields, aBytes + (reinterpret_cast<const uint8_t *>(&aFields) - objectPtr)), ...);
+                },
+                Reflector::Tie(aObject));
+        }
+        else
+        {
+            throw std::invalid_argument("The fields of the object can't be found to be written canonically!");
+        }
+    }
+
+    template <typename Type> constexpr decltype(auto) WriteDeltaObject(Type &aObject, Type &aBaseline)
+    {
+        if constexpr (is_patchable<Type>)
+        {
+            // the elements after the ones of the baseline are new, so they are all written
+            const auto count = std::ranges::size(aObject);
+            const auto countBaseline = std::ranges::size(aBaseline);
+
+            std::vector<size_t> indexes;
+            for (size_t i = 0; i < count; i++)
+            {
+                if (i >= countBaseline || !IsEqual(aObject[i], aBaseline[i]))
+                {
+                    indexes.push_back(i);
+                }
+            }
+
+            WriteCount(count);
+            WriteCount(indexes.size());
+            for (const auto index : indexes)
+            {
+                WriteCount(index);
+                Write(aObject[index]);
+            }
+
+            return *this;
+        }
+        else
+        {
+            return Write(aObject);
+        }
+    }
+
+    // the objects are equal when the reader would get the same from them, so they are compared by their bytes or by
+    // their encoding (the pointers by their pointees and not by their addresses)
+    template <typename Type> [[nodiscard]] static constexpr bool IsEqual(Type &aObject1, Type &aObject2)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            if constexpr (is_known_size<Type>)
+            {
+                return IsEqualBytes(aObject1, aObject2);
+            }
+            else if constexpr (is_range_standard_layout<Type> && !is_path<Type>)
+            {
+                using TypeValueType = range_value_t<Type>;
+                if constexpr (std::has_unique_object_representations_v<TypeValueType>)
+                {
+                    const auto size = std::ranges::size(aObject1) * sizeof(TypeValueType);
+                    return std::ranges::size(aObject1) == std::ranges::size(aObject2) &&
+                           (!size || !std::memcmp(std::ranges::data(aObject1), std::ranges::data(aObject2), size));
+                }
+                else
+                {
+                    return std::ranges::equal(aObject1, aObject2, [](auto &aElement1, auto &aElement2) {
+                        return IsEqualBytes(aElement1, aElement2);
+                    });
+                }
+            }
+        }
+
+        Stream stream1, stream2;
+        StreamWriter(stream1).Write(aObject1);
+        StreamWriter(stream2).Write(aObject2);
+
+        return std::ranges::equal(stream1.View(), stream2.View());
+    }
+
+    // the padding of aggregates is skipped, the other classes are compared with theirs so they may differ when equal
+    template <typename Type> [[nodiscard]] static bool IsEqualBytes(const Type &aObject1, const Type &aObject2) noexcept
+    {
+        if constexpr (std::has_unique_object_representations_v<Type> || std::is_floating_point_v<Type>)
+        {
+            return !std::memcmp(&aObject1, &aObject2, sizeof(Type));
+        }
+        else if constexpr (is_fixed_array<Type>)
+        {
+            return std::ranges::equal(aObject1, aObject2, [](auto &aElement1, auto &aElement2) {
+                return IsEqualBytes(aElement1, aElement2);
+            });
+        }
+        else if constexpr (is_bindable<Type> && detail::find_field_count<Type>() <= REFLECTABLE_FIELDS_MAX)
+        {
+            const auto fields1 = Reflector::Tie(aObject1);
+            const auto fields2 = Reflector::Tie(aObject2);
+
+            return [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                return (IsEqualBytes(std::get<vIndexes>(fields1), std::get<vIndexes>(fields2)) && ...);
+            }(std::make_index_sequence<std::tuple_size_v<decltype(fields1)>>{});
+        }
+        else
+        {
+            return !std::memcmp(&aObject1, &aObject2, sizeof(Type));
+        }
+    }
+
+    constexpr decltype(auto) WriteCount(const Size::size_max aSize)
     {
         mStream->Write(Size::MakeSize(aSize));
         return *this;
     }
 
-    template <typename Type> constexpr decltype(auto) WriteStreamable(Type &aStreamable)
+    [[nodiscard]] constexpr bool IsAligned() noexcept
+    {
+        const auto context = mStream->GetContext();
+        return context && context->Has(StreamContext::Option::ALIGNED);
+    }
+
+    [[nodiscard]] constexpr bool IsCanonical() noexcept
+    {
+        const auto context = mStream->GetContext();
+        return context && context->Has(StreamContext::Option::CANONICAL);
+    }
+
+    // pads aligned streams so the next object starts at aAlignment from the start of the stream
+    constexpr decltype(auto) Align(const size_t aAlignment)
+    {
+        if (IsAligned())
+        {
+            constexpr std::array<uint8_t, ALIGNMENT_MAX> padding{};
+            mStream->Write({padding.data(), (aAlignment - mStream->View().size() % aAlignment) % aAlignment});
+        }
+
+        return *this;
+    }
+
+    // the elements of empty ranges are not read, so they are not aligned
+    template <typename Type> constexpr decltype(auto) AlignRange(const Size::size_max aCount)
+    {
+        if (aCount)
+        {
+            Align(SizeFinder::FindRangeAlignment<Type>());
+        }
+
+        return *this;
+    }
+
+    template <typename Type, bool vPolymorphic = false> constexpr decltype(auto) WriteStreamable(Type &aStreamable)
     {
         static_assert(std::derived_from<Type, IStreamable>, "Type is not a streamable!");
 
-        auto stream(std::move(aStreamable.Serialize()));
+        // nested streamables share our context and are not serialized from scratch
+        const auto context = mStream->GetContext();
+        const auto options = context ? context->mOptions : StreamContext::Option::NONE;
+
+        // a clean cached streamable is copied, it was written with the same options
+        constexpr auto cached = std::derived_from<Type, IStreamableCached>;
+        if constexpr (cached)
+        {
+            if (aStreamable.IsCached(options))
+            {
+                WriteCount(aStreamable.mCache.size());
+                Align(ALIGNMENT_MAX);
+                return mStream->Write(aStreamable.mCache);
+            }
+        }
+
+        aStreamable.Swap(context ? Stream(*context) : Stream());
+
+        // a pointed object or one seen through a reference to its base needs the virtual call
+        if constexpr (vPolymorphic || std::is_abstract_v<Type>)
+        {
+            aStreamable.ToStream();
+        }
+        else if (std::is_final_v<Type> || typeid(aStreamable) == typeid(Type))
+        {
+            aStreamable.Type::ToStream();
+        }
+        else
+        {
+            aStreamable.ToStream();
+        }
+
+        auto stream(std::move(aStreamable.Release()));
         const auto streamView = stream.View();
 
+        if constexpr (cached)
+        {
+            if (!context || !context->Has(StreamContext::Option::IDENTITY))
+            {
+                aStreamable.Cache(streamView, options);
+            }
+        }
+
         // we write the size in bytes of the stream
         WriteCount(streamView.size());
+        Align(ALIGNMENT_MAX);
         return mStream->Write(streamView);
     }
 
+    template <typename Type> constexpr decltype(auto) WritePointer(Type &aPointer)
+    {
+        static_assert(is_any_pointer<Type>, "Type is not a smart/raw pointer!");
+
+        using TypeNoPtr = std::conditional_t<std::is_pointer_v<Type>, std::remove_pointer_t<Type>,
+                                             typename std::pointer_traits<Type>::element_type>;
+
+        // shared objects are written only once, later they are written as a reference to the first one
+        if constexpr (is_shared_ptr_v<Type>)
+        {
+            const auto context = mStream->GetContext();
+            if (context && context->Has(StreamContext::Option::IDENTITY))
+            {
+                // the same address can hold different objects, like a class and its first member
+                auto &[identity, type] = context->mIdentitiesWritten[aPointer.get()];
+                if (identity && *type == typeid(TypeNoPtr))
+                {
+                    return WriteCount(identity);
+                }
+
+                identity = ++context->mIdentitiesWrittenCount;
+                type = &typeid(TypeNoPtr);
+
+                WriteCount(0);
+            }
+        }
+
+        // registered derived classes are prefixed by their index so the reader knows what to allocate
+        if constexpr (is_derived_from_pointer<Type, IStreamable> && has_streamable_derived<TypeNoPtr>)
+        {
+            using TypeDerived = std::type_identity<typename TypeNoPtr::StreamableDerived>;
+            WriteCount(FindDerivedIndex(*aPointer, TypeDerived{}));
+        }
+
+        if constexpr (is_derived_from_pointer<Type, IStreamable>)
+        {
+            WriteStreamable<TypeNoPtr, true>(*aPointer);
+        }
+        else
+        {
+            Write(*aPointer);
+        }
+
+        return *this;
+    }
+
+    template <typename Type, typename... Types>
+    [[nodiscard]] static Size::size_max FindDerivedIndex(const Type &aStreamable,
+                                                         const std::type_identity<std::tuple<Types...>>)
+    {
+        static_assert(sizeof...(Types), "There are no registered derived streamables!");
+
+        // the exact class must be registered, else it would be read back as a base class
+        Size::size_max index{};
+        if (!((typeid(aStreamable) == typeid(Types) || (index++, false)) || ...))
+        {
+            throw std::out_of_range("The derived streamable is not registered!");
+        }
+
+        return index;
+    }
+
+    template <typename Type> constexpr decltype(auto) WriteFixedExtent(Type &aRange)
+    {
+        static_assert(is_fixed_extent<Type>, "Type is not an array or a span of fixed extent!");
+
+        // the elements of arrays of known size are contiguous, spans point to them so we copy what they point to
+        if constexpr (is_known_size<Type>)
+        {
+            WriteObjectOfKnownSize(aRange);
+        }
+        else if constexpr (is_span_v<Type> && is_known_size<typename Type::value_type>)
+        {
+            WriteBlock(aRange.data(), aRange.size());
+        }
+        else
+        {
+            for (auto &object : aRange)
+            {
+                Write(object);
+            }
+        }
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) WriteShaped(Type &aShaped)
+    {
+        static_assert(is_shaped<Type>, "Type is not a dense or rectangular array!");
+
+        // the rows have the same count, so the shape is written once instead of a count per row
+        if constexpr (is_dense_v<Type>)
+        {
+            std::ranges::for_each(aShaped.GetShape(), [&](const auto aExtent) { WriteCount(aExtent); });
+            Align(SizeFinder::FindAlignment<typename Type::value_type>());
+
+            const auto elements = aShaped.GetElements();
+            WriteBlock(elements.data(), elements.size());
+        }
+        else
+        {
+            std::ranges::for_each(aShaped.FindShape(), [&](const auto aExtent) { WriteCount(aExtent); });
+            Align(SizeFinder::FindAlignment<typename Type::value_type>());
+
+            aShaped.ForEachRow([&](auto &aRow) {
+                const auto row = std::span(aRow);
+                WriteBlock(row.data(), row.size());
+            });
+        }
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) WriteColumnar(Type &aColumnar)
+    {
+        static_assert(is_columnar_v<Type>, "Type is not a columnar range!");
+
+        WriteCount(aColumnar.FindCount());
+
+        // the columns have the count of the records, the contiguous ones of known size are written as a single block
+        aColumnar.ForEachColumn([&](auto &&aColumn) {
+            using TypeColumn = std::remove_cvref_t<decltype(aColumn)>;
+
+            Align(SizeFinder::FindRangeAlignment<TypeColumn>());
+            if constexpr (std::ranges::contiguous_range<TypeColumn> && is_known_size<range_value_t<TypeColumn>>)
+            {
+                const auto column = std::span(aColumn);
+                WriteBlock(column.data(), column.size());
+            }
+            else
+            {
+                for (auto &&object : aColumn)
+                {
+                    Write(object);
+                }
+            }
+        });
+
+        return *this;
+    }
+
     template <typename Type> constexpr decltype(auto) WriteRange(Type &aRange)
     {
         static_assert(std::ranges::range<Type>, "Type is not a range!");
 
-        if constexpr (SizeFinder::FindRangeRank<Type>() > 1)
+        // the count of unsized ranges is inserted before their elements, that would move them from their alignment
+        if constexpr (!has_method_size<Type> && !is_path<Type>)
         {
-            WriteCount(SizeFinder::GetRangeCount(aRange));
-            for (auto &object : aRange)
+            if (IsAligned())
             {
-                WriteRange(object);
+                std::vector<range_value_t<Type>> objects;
+                for (auto &&object : aRange)
+                {
+                    objects.push_back(std::forward<decltype(object)>(object));
+                }
+
+                return WriteRange(objects);
             }
         }
+
+        if constexpr (is_unordered<Type>)
+        {
+            if (IsCanonical())
+            {
+                return WriteRangeCanonical(aRange);
+            }
+        }
+
+        if constexpr (SizeFinder::FindRangeRank<Type>() > 1)
+        {
+            WriteRangeElements(aRange, [&](auto &aObject) { WriteRange(aObject); });
+        }
         else
         {
             WriteRangeRank1(aRange);
@@ -107,13 +678,52 @@ class StreamWriter
         return *this;
     }
 
+    // the order of unordered containers depends on their history, so their elements are sorted by their bytes
+    template <typename Type> constexpr decltype(auto) WriteRangeCanonical(Type &aRange)
+    {
+        static_assert(is_unordered<Type>, "Type is not an unordered container!");
+
+        // the bytes to sort by don't depend on the other options, like the identities of the objects written before
+        StreamContext context(StreamContext::Option::CANONICAL);
+
+        std::vector<std::pair<Stream::vector, decltype(&*std::ranges::begin(aRange))>> objects;
+        objects.reserve(SizeFinder::GetRangeCount(aRange));
+        for (auto &object : aRange)
+        {
+            Stream stream(context);
+            StreamWriter(stream).Write(object);
+            objects.emplace_back(stream.Release(), &object);
+        }
+
+        std::ranges::sort(objects, {}, &decltype(objects)::value_type::first);
+
+        WriteCount(objects.size());
+        AlignRange<Type>(objects.size());
+
+        // without the other options the bytes sorted by are the ones we would write
+        if (!IsAligned() && !mStream->GetContext()->Has(StreamContext::Option::IDENTITY))
+        {
+            for (auto &[bytes, object] : objects)
+            {
+                mStream->Write(bytes);
+            }
+
+            return *this;
+        }
+
+        for (auto &[bytes, object] : objects)
+        {
+            Write(*object);
+        }
+
+        return *this;
+    }
+
     template <typename Type> constexpr decltype(auto) WriteRangeStandardLayout(const Type &aRange)
     {
         static_assert(is_range_standard_layout<Type>, "Type is not a standard layout range!");
 
-        using TypeValueType = typename Type::value_type;
-
-        if constexpr (is_utf16string<Type>)
+        if constexpr (is_wide_string<Type>)
         {
             WriteRangeStandardLayout(Converter::Encode(aRange));
         }
@@ -124,10 +734,19 @@ class StreamWriter
         else
         {
             WriteCount(SizeFinder::GetRangeCount(aRange));
+            AlignRange<Type>(SizeFinder::GetRangeCount(aRange));
+
+            if (std::is_constant_evaluated())
+            {
+                for (auto &object : aRange)
+                {
+                    WriteObjectOfKnownSize(object);
+                }
 
-            const auto rangePtr = reinterpret_cast<const uint8_t *>(std::ranges::data(aRange));
-            const auto rangeSize = SizeFinder::GetRangeCount(aRange) * sizeof(TypeValueType);
-            mStream->Write({rangePtr, rangeSize});
+                return *this;
+            }
+
+            WriteBlock(std::ranges::data(aRange), SizeFinder::GetRangeCount(aRange));
         }
 
         return *this;
@@ -142,13 +761,43 @@ class StreamWriter
             WriteRangeStandardLayout(aRange);
         }
         else
+        {
+            WriteRangeElements(aRange, [&](auto &aObject) { Write(aObject); });
+        }
+
+        return *this;
+    }
+
+    template <typename Type, typename FunctionWrite>
+    constexpr decltype(auto) WriteRangeElements(Type &aRange, FunctionWrite &&aFunctionWrite)
+    {
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        if constexpr (has_method_size<Type>)
         {
             WriteCount(SizeFinder::GetRangeCount(aRange));
-            for (auto &object : aRange)
+            AlignRange<Type>(SizeFinder::GetRangeCount(aRange));
+
+            for (auto &&object : aRange)
             {
-                Write(object);
+                aFunctionWrite(object);
             }
         }
+        else
+        {
+            // unsized ranges (filters, generators etc...) may be traversed only once, so we count while writing and
+            // insert the count in front of the elements afterwards, the reader sees a normal range
+            const auto offset = mStream->View().size();
+
+            Size::size_max count{};
+            for (auto &&object : aRange)
+            {
+                aFunctionWrite(object);
+                count++;
+            }
+
+            mStream->Insert(offset, Size::MakeSize(count));
+        }
 
         return *this;
     }
@@ -197,6 +846,29 @@ class StreamWriter
             auto &first = const_cast<std::remove_const_t<typename Type::first_type> &>(aObject.first);
             return WriteAll(first, aObject.second);
         }
+        else if constexpr (is_shaped<Type>)
+        {
+            return WriteShaped(aObject);
+        }
+        else if constexpr (is_columnar_v<Type>)
+        {
+            return WriteColumnar(aObject);
+        }
+        else if constexpr (is_fixed_extent<Type>)
+        {
+            return WriteFixedExtent(aObject);
+        }
+        else if constexpr (has_streamable_fields<Type>)
+        {
+            // the fields are written one after another, without a size in bytes like streamables
+            std::apply([&](auto &&...aArgs) { WriteAll(aArgs...); }, StreamableFields(aObject));
+            return *this;
+        }
+        else if constexpr (is_reflectable<Type>)
+        {
+            std::apply([&](auto &&...aArgs) { WriteAll(aArgs...); }, Reflector::Tie(aObject));
+            return *this;
+        }
         else if constexpr (std::ranges::range<Type>)
         {
             return WriteRange(aObject);
@@ -207,7 +879,7 @@ class StreamWriter
         }
         else if constexpr (is_any_pointer<Type>)
         {
-            return Write(*aObject);
+            return WritePointer(aObject);
         }
         else if constexpr (is_standard_layout_no_pointer<Type>)
         {
@@ -0,0 +1,133 @@
+/*
+    Copyright (c) 2024 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma once
+
+#include "Reflector.h"
+#include "SizeFinder.h"
+
+namespace hbann
+{
+/*
+    Marks a range of records (streamables, classes with fields or aggregates) to be written as a column per field
+
+    It's written as the count of records followed by every column without a count, the columns of objects of known size
+    being a single block, so the same bytes can be read back as records or straight in a tuple of ranges.
+    Ex.: mStreamWriter.WriteAll(hbann::Columnar(mRecords));
+         mStreamReader.ReadAll(hbann::Columnar(std::tie(mIds, mValues)));
+*/
+template <typename Type> class Columnar
+{
+  public:
+    constexpr explicit Columnar(Type &aRecords) noexcept
+        requires(!is_tuple_v<Type>)
+        : mColumns(&aRecords)
+    {
+    }
+
+    constexpr explicit Columnar(const Type &aColumns) noexcept
+        requires is_tuple_v<Type>
+        : mColumns(aColumns)
+    {
+    }
+
+    [[nodiscard]] static consteval Size::size_max FindMinSize() noexcept
+    {
+        return FindSize([]<typename TypeField> { return SizeFinder::FindMinSize<TypeField>(); });
+    }
+
+    [[nodiscard]] static consteval Size::size_max FindRecordSize() noexcept
+    {
+        return FindSize([]<typename TypeField> { return sizeof(TypeField); });
+    }
+
+    [[nodiscard]] constexpr Size::size_max FindCount() const
+    {
+        if constexpr (is_tuple_v<Type>)
+        {
+            const auto count = SizeFinder::GetRangeCount(std::get<0>(mColumns));
+            if (!std::apply([&](auto &...aColumns) { return ((SizeFinder::GetRangeCount(aColumns) == count) && ...); },
+                            mColumns))
+            {
+                throw std::out_of_range("The columns don't have the same count!");
+            }
+
+            return count;
+        }
+        else
+        {
+            return SizeFinder::GetRangeCount(*mColumns);
+        }
+    }
+
+    constexpr void Resize(const Size::size_max aCount)
+    {
+        if constexpr (is_tuple_v<Type>)
+        {
+            std::apply([&](auto &...aColumns) { (aColumns.resize(aCount), ...); }, mColumns);
+        }
+        else
+        {
+            mColumns->resize(aCount);
+        }
+    }
+
+    // calls aFunction with every column, a range of the fields of the records or a range of the tuple
+    template <typename Function> constexpr void ForEachColumn(Function &&aFunction) const
+    {
+        if constexpr (is_tuple_v<Type>)
+        {
+            std::apply([&](auto &...aColumns) { (aFunction(aColumns), ...); }, mColumns);
+        }
+        else
+        {
+            [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                (aFunction(*mColumns | std::views::transform([](auto &aRecord) -> decltype(auto) {
+                     return std::get<vIndexes>(Reflector::TieFields(aRecord));
+                 })),
+                 ...);
+            }(std::make_index_sequence<std::tuple_size_v<typename decltype(FindFields())::type>>{});
+        }
+    }
+
+  private:
+    std::conditional_t<is_tuple_v<Type>, Type, Type *> mColumns{};
+
+    // the fields of a record or the columns of the tuple, wrapped in a std::type_identity
+    [[nodiscard]] static consteval auto FindFields() noexcept
+    {
+        if constexpr (is_tuple_v<Type>)
+        {
+            return std::type_identity<Type>{};
+        }
+        else
+        {
+            using TypeFields = decltype(Reflector::TieFields(std::declval<std::ranges::range_reference_t<Type>>()));
+            return std::type_identity<TypeFields>{};
+        }
+    }
+
+    template <typename Function> [[nodiscard]] static consteval Size::size_max FindSize(Function &&aFunction) noexcept
+    {
+        using TypeFields = typename decltype(FindFields())::type;
+
+        return [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+            if constexpr (is_tuple_v<Type>)
+            {
+                return (Size::size_max{} + ... +
+                        aFunction.template operator()<range_value_t<
+                            std::remove_cvref_t<std::tuple_element_t<vIndexes, TypeFields>>>>());
+            }
+            else
+            {
+                return (Size::size_max{} + ... +
+                        aFunction.template operator()<
+                            std::remove_cvref_t<std::tuple_element_t<vIndexes, TypeFields>>>());
+            }
+        }(std::make_index_sequence<std::tuple_size_v<TypeFields>>{});
+    }
+};
+} // namespace hbann
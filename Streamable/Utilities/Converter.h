@@ -28,44 +28,353 @@ template <> [[nodiscard]] constexpr uint64_t ByteSwap(const uint64_t aSize) noex
            ((aSize & 0x000000000000FF00) << 40) | ((aSize & 0x00000000000000FF) << 56);
 }
 
+/*
+    Transcodes the UTF-16 and UTF-32 strings (ex.: std::wstring) to UTF-8 and back, on every platform
+
+    The runs of ASCII characters are copied 16 at a time with SSE2 or NEON, the other characters one by one. The code
+    units that are not valid (ex.: unpaired surrogates) become U+FFFD, like the bytes that are not valid UTF-8.
+*/
 class Converter
 {
   public:
-    template <typename Type> [[nodiscard]] static constexpr auto Encode(const Type &aString)
+    static constexpr char32_t REPLACEMENT = 0xFFFD;
+
+    template <typename Type> [[nodiscard]] static constexpr std::string Encode(const Type &aString)
+    {
+        static_assert(is_wide_string<Type>, "Type must be a UTF16 or UTF32 string!");
+
+        // a UTF-16 code unit is at most 3 bytes (a surrogate pair is 4 bytes) and a UTF-32 one at most 4 bytes
+        std::string bytes(aString.size() * (is_utf16string<Type> ? 3 : 4), 0);
+        const auto units = aString.data();
+        const auto count = aString.size();
+
+        size_t size{};
+        for (size_t i = 0; i < count;)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const auto countAscii = EncodeAscii(units + i, count - i, bytes.data() + size);
+                i += countAscii;
+                size += countAscii;
+
+                if (i == count)
+                {
+                    break;
+                }
+            }
+
+            auto codePoint = static_cast<char32_t>(FindUnit(units[i++]));
+            if constexpr (is_utf16string<Type>)
+            {
+                if (IsSurrogateHigh(codePoint) && i < count && IsSurrogateLow(FindUnit(units[i])))
+                {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (FindUnit(units[i++]) - 0xDC00);
+                }
+            }
+
+            size += EncodeCodePoint(codePoint, bytes.data() + size);
+        }
+
+        bytes.resize(size);
+        return bytes;
+    }
+
+    template <typename Type> [[nodiscard]] static constexpr Type Decode(const std::span<const uint8_t> aBytes)
+    {
+        static_assert(is_wide_string<Type>, "Type must be a UTF16 or UTF32 string!");
+
+        // a byte is at most a code unit
+        Type string(aBytes.size(), 0);
+        const auto bytes = aBytes.data();
+        const auto count = aBytes.size();
+
+        size_t size{};
+        for (size_t i = 0; i < count;)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const auto countAscii = DecodeAscii(bytes + i, count - i, string.data() + size);
+                i += countAscii;
+                size += countAscii;
+
+                if (i == count)
+                {
+                    break;
+                }
+            }
+
+            const auto codePoint = DecodeCodePoint(aBytes, i);
+            if constexpr (is_utf16string<Type>)
+            {
+                if (codePoint >= 0x10000)
+                {
+                    string[size++] = static_cast<typename Type::value_type>(0xD800 + ((codePoint - 0x10000) >> 10));
+                    string[size++] = static_cast<typename Type::value_type>(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+                    continue;
+                }
+            }
+
+            string[size++] = static_cast<typename Type::value_type>(codePoint);
+        }
+
+        string.resize(size);
+        return string;
+    }
+
+  private:
+    // the value of a code unit, wchar_t may be signed
+    template <typename TypeUnit> [[nodiscard]] static constexpr uint32_t FindUnit(const TypeUnit aUnit) noexcept
     {
-        static_assert(is_utf16string<Type>, "Type must be a UTF16 string!");
-
-#ifdef _WIN32
-        const auto requiredSize = WideCharToMultiByte(CP_UTF8, 0, reinterpret_cast<LPCWCH>(aString.data()),
-                                                      static_cast<int>(aString.size()), nullptr, 0, nullptr, nullptr);
-        std::string str(requiredSize, 0);
-
-        WideCharToMultiByte(CP_UTF8, 0, reinterpret_cast<LPCWCH>(aString.data()), static_cast<int>(aString.size()),
-                            str.data(), requiredSize, nullptr, nullptr);
-        return str;
-#else
-        return std::string_view{reinterpret_cast<const std::string::value_type *>(aString.data()),
-                                aString.size() * sizeof(typename Type::value_type)};
+        return static_cast<std::make_unsigned_t<TypeUnit>>(aUnit);
+    }
+
+    [[nodiscard]] static constexpr bool IsSurrogateHigh(const char32_t aUnit) noexcept
+    {
+        return aUnit >= 0xD800 && aUnit <= 0xDBFF;
+    }
+
+    [[nodiscard]] static constexpr bool IsSurrogateLow(const char32_t aUnit) noexcept
+    {
+        return aUnit >= 0xDC00 && aUnit <= 0xDFFF;
+    }
+
+    [[nodiscard]] static constexpr size_t EncodeCodePoint(char32_t aCodePoint, char *aBytes) noexcept
+    {
+        if ((aCodePoint >= 0xD800 && aCodePoint <= 0xDFFF) || aCodePoint > 0x10FFFF)
+        {
+            aCodePoint = REPLACEMENT;
+        }
+
+        if (aCodePoint < 0x80)
+        {
+            aBytes[0] = static_cast<char>(aCodePoint);
+            return 1;
+        }
+
+        if (aCodePoint < 0x800)
+        {
+            aBytes[0] = static_cast<char>(0xC0 | aCodePoint >> 6);
+            aBytes[1] = static_cast<char>(0x80 | (aCodePoint & 0x3F));
+            return 2;
+        }
+
+        if (aCodePoint < 0x10000)
+        {
+            aBytes[0] = static_cast<char>(0xE0 | aCodePoint >> 12);
+            aBytes[1] = static_cast<char>(0x80 | (aCodePoint >> 6 & 0x3F));
+            aBytes[2] = static_cast<char>(0x80 | (aCodePoint & 0x3F));
+            return 3;
+        }
+
+        aBytes[0] = static_cast<char>(0xF0 | aCodePoint >> 18);
+        aBytes[1] = static_cast<char>(0x80 | (aCodePoint >> 12 & 0x3F));
+        aBytes[2] = static_cast<char>(0x80 | (aCodePoint >> 6 & 0x3F));
+        aBytes[3] = static_cast<char>(0x80 | (aCodePoint & 0x3F));
+        return 4;
+    }
+
+    // decodes the code point at aIndex and moves after it, a sequence that is not valid is replaced up to the first
+    // byte that can't continue it (overlong forms, surrogates and code points after U+10FFFF are not valid)
+    [[nodiscard]] static constexpr char32_t DecodeCodePoint(const std::span<const uint8_t> aBytes, size_t &aIndex)
+    {
+        const auto lead = aBytes[aIndex++];
+        if (lead < 0x80)
+        {
+            return lead;
+        }
+
+        size_t count{};
+        char32_t codePoint{};
+        uint8_t lower = 0x80, upper = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF)
+        {
+            count = 1;
+            codePoint = lead & 0x1F;
+        }
+        else if (lead >= 0xE0 && lead <= 0xEF)
+        {
+            count = 2;
+            codePoint = lead & 0x0F;
+            lower = lead == 0xE0 ? 0xA0 : lower;
+            upper = lead == 0xED ? 0x9F : upper;
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4)
+        {
+            count = 3;
+            codePoint = lead & 0x07;
+            lower = lead == 0xF0 ? 0x90 : lower;
+            upper = lead == 0xF4 ? 0x8F : upper;
+        }
+        else
+        {
+            return REPLACEMENT;
+        }
+
+        // the bounds of the second byte rule out the overlong forms, the surrogates and the code points too big
+        for (size_t i = 0; i < count; i++, lower = 0x80, upper = 0xBF)
+        {
+            if (aIndex == aBytes.size() || aBytes[aIndex] < lower || aBytes[aIndex] > upper)
+            {
+                return REPLACEMENT;
+            }
+
+            codePoint = codePoint << 6 | (aBytes[aIndex++] & 0x3F);
+        }
+
+        return codePoint;
+    }
+
+    // copies the ASCII characters from the start of aUnits, returns their count
+    template <typename TypeUnit>
+    [[nodiscard]] static size_t EncodeAscii(const TypeUnit *aUnits, const size_t aCount, char *aBytes) noexcept
+    {
+        size_t i{};
+
+#if defined(STREAMABLE_SSE2)
+        for (; i + 16 <= aCount; i += 16)
+        {
+            const auto units = reinterpret_cast<const __m128i *>(aUnits + i);
+            __m128i bytes{};
+            if constexpr (sizeof(TypeUnit) == sizeof(char16_t))
+            {
+                const auto units1 = _mm_loadu_si128(units);
+                const auto units2 = _mm_loadu_si128(units + 1);
+                const auto unitsHigh = _mm_and_si128(_mm_or_si128(units1, units2), _mm_set1_epi16(~0x7F));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(unitsHigh, _mm_setzero_si128())) != 0xFFFF)
+                {
+                    break;
+                }
+
+                bytes = _mm_packus_epi16(units1, units2);
+            }
+            else
+            {
+                const auto units1 = _mm_loadu_si128(units);
+                const auto units2 = _mm_loadu_si128(units + 1);
+                const auto units3 = _mm_loadu_si128(units + 2);
+                const auto units4 = _mm_loadu_si128(units + 3);
+                const auto unitsOr = _mm_or_si128(_mm_or_si128(units1, units2), _mm_or_si128(units3, units4));
+                const auto unitsHigh = _mm_and_si128(unitsOr, _mm_set1_epi32(~0x7F));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(unitsHigh, _mm_setzero_si128())) != 0xFFFF)
+                {
+                    break;
+                }
+
+                bytes = _mm_packus_epi16(_mm_packs_epi32(units1, units2), _mm_packs_epi32(units3, units4));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(aBytes + i), bytes);
+        }
+#elif defined(STREAMABLE_NEON)
+        for (; i + 16 <= aCount; i += 16)
+        {
+            uint8x16_t bytes{};
+            if constexpr (sizeof(TypeUnit) == sizeof(char16_t))
+            {
+                const auto units = reinterpret_cast<const uint16_t *>(aUnits + i);
+                const auto units1 = vld1q_u16(units);
+                const auto units2 = vld1q_u16(units + 8);
+                if (vmaxvq_u16(vorrq_u16(units1, units2)) >= 0x80)
+                {
+                    break;
+                }
+
+                bytes = vcombine_u8(vmovn_u16(units1), vmovn_u16(units2));
+            }
+            else
+            {
+                const auto units = reinterpret_cast<const uint32_t *>(aUnits + i);
+                const auto units1 = vld1q_u32(units);
+                const auto units2 = vld1q_u32(units + 4);
+                const auto units3 = vld1q_u32(units + 8);
+                const auto units4 = vld1q_u32(units + 12);
+                if (vmaxvq_u32(vorrq_u32(vorrq_u32(units1, units2), vorrq_u32(units3, units4))) >= 0x80)
+                {
+                    break;
+                }
+
+                bytes = vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(units1), vmovn_u32(units2))),
+                                    vmovn_u16(vcombine_u16(vmovn_u32(units3), vmovn_u32(units4))));
+            }
+
+            vst1q_u8(reinterpret_cast<uint8_t *>(aBytes + i), bytes);
+        }
 #endif
+
+        for (; i < aCount && FindUnit(aUnits[i]) < 0x80; i++)
+        {
+            aBytes[i] = static_cast<char>(aUnits[i]);
+        }
+
+        return i;
     }
 
-    template <typename Type> [[nodiscard]] static constexpr auto Decode(const std::span<const uint8_t> aString)
+    // copies the ASCII characters from the start of aBytes, returns their count
+    template <typename TypeUnit>
+    [[nodiscard]] static size_t DecodeAscii(const uint8_t *aBytes, const size_t aCount, TypeUnit *aUnits) noexcept
     {
-        static_assert(is_utf16string<Type>, "Type must be a UTF16 string!");
-
-#ifdef _WIN32
-        const auto requiredSize = MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<LPCCH>(aString.data()),
-                                                      static_cast<int>(aString.size()), nullptr, 0);
-        Type str(requiredSize, 0);
-
-        MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<LPCCH>(aString.data()), static_cast<int>(aString.size()),
-                            str.data(), requiredSize);
-        return str;
-#else
-        using TypeValueType = typename Type::value_type;
-        return std::basic_string_view<TypeValueType>{reinterpret_cast<const TypeValueType *>(aString.data()),
-                                                     aString.size() / sizeof(TypeValueType)};
+        size_t i{};
+
+#if defined(STREAMABLE_SSE2)
+        for (; i + 16 <= aCount; i += 16)
+        {
+            const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBytes + i));
+            if (_mm_movemask_epi8(bytes))
+            {
+                break;
+            }
+
+            const auto units = reinterpret_cast<__m128i *>(aUnits + i);
+            const auto zero = _mm_setzero_si128();
+            const auto units1 = _mm_unpacklo_epi8(bytes, zero);
+            const auto units2 = _mm_unpackhi_epi8(bytes, zero);
+            if constexpr (sizeof(TypeUnit) == sizeof(char16_t))
+            {
+                _mm_storeu_si128(units, units1);
+                _mm_storeu_si128(units + 1, units2);
+            }
+            else
+            {
+                _mm_storeu_si128(units, _mm_unpacklo_epi16(units1, zero));
+                _mm_storeu_si128(units + 1, _mm_unpackhi_epi16(units1, zero));
+                _mm_storeu_si128(units + 2, _mm_unpacklo_epi16(units2, zero));
+                _mm_storeu_si128(units + 3, _mm_unpackhi_epi16(units2, zero));
+            }
+        }
+#elif defined(STREAMABLE_NEON)
+        for (; i + 16 <= aCount; i += 16)
+        {
+            const auto bytes = vld1q_u8(aBytes + i);
+            if (vmaxvq_u8(bytes) >= 0x80)
+            {
+                break;
+            }
+
+            const auto units1 = vmovl_u8(vget_low_u8(bytes));
+            const auto units2 = vmovl_u8(vget_high_u8(bytes));
+            if constexpr (sizeof(TypeUnit) == sizeof(char16_t))
+            {
+                const auto units = reinterpret_cast<uint16_t *>(aUnits + i);
+                vst1q_u16(units, units1);
+                vst1q_u16(units + 8, units2);
+            }
+            else
+            {
+                const auto units = reinterpret_cast<uint32_t *>(aUnits + i);
+                vst1q_u32(units, vmovl_u16(vget_low_u16(units1)));
+                vst1q_u32(units + 4, vmovl_u16(vget_high_u16(units1)));
+                vst1q_u32(units + 8, vmovl_u16(vget_low_u16(units2)));
+                vst1q_u32(units + 12, vmovl_u16(vget_high_u16(units2)));
+            }
+        }
 #endif
+
+        for (; i < aCount && aBytes[i] < 0x80; i++)
+        {
+            aUnits[i] = static_cast<TypeUnit>(aBytes[i]);
+        }
+
+        return i;
     }
 };
 } // namespace hbann
@@ -0,0 +1,71 @@
+/*
+    Copyright (c) 2024 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma once
+
+namespace hbann
+{
+/*
+    Deleter for smart pointers whose objects may be allocated from a memory resource (pool, slab etc...)
+
+    Without a memory resource it behaves like std::default_delete, so it can own objects allocated with new too. It
+    keeps the resource, the size and the alignment, so the std::unique_ptr using it is 4 times bigger.
+*/
+template <typename Type> class Deleter
+{
+    template <typename> friend class Deleter;
+
+  public:
+    constexpr Deleter() noexcept = default;
+
+    template <typename TypeDerived>
+        requires std::convertible_to<TypeDerived *, Type *>
+    constexpr Deleter(const std::default_delete<TypeDerived> &) noexcept
+    {
+    }
+
+    constexpr Deleter(std::pmr::memory_resource *aMemoryResource, const std::size_t aSize,
+                      const std::size_t aAlignment) noexcept
+        : mMemoryResource(aMemoryResource), mSize(aSize), mAlignment(aAlignment)
+    {
+    }
+
+    template <typename TypeDerived>
+        requires std::convertible_to<TypeDerived *, Type *>
+    constexpr Deleter(const Deleter<TypeDerived> &aDeleter) noexcept
+        : mMemoryResource(aDeleter.mMemoryResource), mSize(aDeleter.mSize), mAlignment(aDeleter.mAlignment)
+    {
+    }
+
+    constexpr void operator()(Type *aObject) const
+    {
+        if (!mMemoryResource)
+        {
+            delete aObject;
+            return;
+        }
+
+        // the memory starts at the most derived object, that could be before a base class
+        void *object{};
+        if constexpr (std::is_polymorphic_v<Type>)
+        {
+            object = dynamic_cast<void *>(aObject);
+        }
+        else
+        {
+            object = aObject;
+        }
+
+        std::destroy_at(aObject);
+        mMemoryResource->deallocate(object, mSize, mAlignment);
+    }
+
+  private:
+    std::pmr::memory_resource *mMemoryResource{};
+    std::size_t mSize{};
+    std::size_t mAlignment{};
+};
+} // namespace hbann
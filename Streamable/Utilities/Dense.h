@@ -0,0 +1,93 @@
+/*
+    Copyright (c) 2024 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma once
+
+#include "SizeFinder.h"
+
+namespace hbann
+{
+/*
+    N-D array of objects of known size stored contiguously in row major order (like a std::mdspan over its own buffer)
+
+    It's written as its shape followed by its elements in a single block, the same as a Rectangular range, so a
+    rectangular range of ranges can be read back flat.
+*/
+template <typename Type, size_t vRank> class Dense
+{
+    static_assert(vRank, "A dense array must have at least a dimension!");
+    static_assert(is_known_size<Type>, "Type is not an object of known size!");
+
+  public:
+    using value_type = Type;
+    using shape_type = std::array<Size::size_max, vRank>;
+
+    static constexpr auto rank = vRank;
+
+    constexpr Dense() noexcept = default;
+
+    constexpr explicit Dense(const shape_type &aShape)
+    {
+        Reshape(aShape);
+    }
+
+    [[nodiscard]] constexpr const shape_type &GetShape() const noexcept
+    {
+        return mShape;
+    }
+
+    [[nodiscard]] constexpr std::span<Type> GetElements() noexcept
+    {
+        return mElements;
+    }
+
+    [[nodiscard]] constexpr std::span<const Type> GetElements() const noexcept
+    {
+        return mElements;
+    }
+
+    constexpr void Reshape(const shape_type &aShape)
+    {
+        mShape = aShape;
+
+        Size::size_max count{1};
+        for (const auto extent : aShape)
+        {
+            count *= extent;
+        }
+
+        mElements.resize(count);
+    }
+
+    template <typename... Indexes>
+        requires(sizeof...(Indexes) == vRank)
+    [[nodiscard]] constexpr Type &operator()(const Indexes... aIndexes) noexcept
+    {
+        return mElements[FindIndex(aIndexes...)];
+    }
+
+    template <typename... Indexes>
+        requires(sizeof...(Indexes) == vRank)
+    [[nodiscard]] constexpr const Type &operator()(const Indexes... aIndexes) const noexcept
+    {
+        return mElements[FindIndex(aIndexes...)];
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Dense &) const = default;
+
+  private:
+    shape_type mShape{};
+    std::vector<Type> mElements;
+
+    template <typename... Indexes> [[nodiscard]] constexpr size_t FindIndex(const Indexes... aIndexes) const noexcept
+    {
+        size_t index{}, dimension{};
+        ((index = index * mShape[dimension++] + static_cast<size_t>(aIndexes)), ...);
+
+        return index;
+    }
+};
+} // namespace hbann
@@ -0,0 +1,127 @@
+/*
+    Copyright (c) 2024 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma once
+
+namespace hbann
+{
+/*
+    Encodes objects in bytes that compare with memcmp (and then by their size) like the objects compare with operator<
+
+    The numbers are big endian with the sign bit flipped, the strings are terminated by 0 0 (a 0 in them is followed
+    by 0xFF) and the elements of the other ranges by a 1 before each of them and a 0 at the end, so every encoding is a
+    prefix of no other and the objects can be concatenated (ex.: the fields of a record). It's not read back.
+*/
+class Key
+{
+  public:
+    template <typename... Types> [[nodiscard]] static constexpr std::vector<uint8_t> Encode(const Types &...aObjects)
+    {
+        std::vector<uint8_t> bytes;
+        (EncodeObject(bytes, aObjects), ...);
+
+        return bytes;
+    }
+
+  private:
+    template <typename Type> static constexpr void EncodeObject(std::vector<uint8_t> &aBytes, const Type &aObject)
+    {
+        if constexpr (std::is_same_v<Type, bool>)
+        {
+            aBytes.push_back(aObject);
+        }
+        else if constexpr (std::is_enum_v<Type>)
+        {
+            EncodeObject(aBytes, static_cast<std::underlying_type_t<Type>>(aObject));
+        }
+        else if constexpr (std::unsigned_integral<Type>)
+        {
+            EncodeUnsigned(aBytes, aObject);
+        }
+        else if constexpr (std::signed_integral<Type>)
+        {
+            // the negatives are before the positives
+            using TypeUnsigned = std::make_unsigned_t<Type>;
+            EncodeUnsigned(aBytes, static_cast<TypeUnsigned>(static_cast<TypeUnsigned>(aObject) ^ FindSignBit<Type>()));
+        }
+        else if constexpr (std::is_same_v<Type, float> || std::is_same_v<Type, double>)
+        {
+            using TypeUnsigned = std::conditional_t<sizeof(Type) == sizeof(uint32_t), uint32_t, uint64_t>;
+
+            // -0 is 0 and every NaN is the quiet one, after +infinity, the bits of the negatives are flipped so a
+            // bigger magnitude is smaller
+            auto object = aObject;
+            if (object != object)
+            {
+                object = std::numeric_limits<Type>::quiet_NaN();
+            }
+            else if (object == Type{})
+            {
+                object = Type{};
+            }
+
+            const auto bits = std::bit_cast<TypeUnsigned>(object);
+            constexpr auto signBit = FindSignBit<TypeUnsigned>();
+            EncodeUnsigned(aBytes, static_cast<TypeUnsigned>(bits & signBit ? ~bits : bits | signBit));
+        }
+        else if constexpr (is_optional_v<Type>)
+        {
+            aBytes.push_back(aObject.has_value());
+            if (aObject)
+            {
+                EncodeObject(aBytes, *aObject);
+            }
+        }
+        else if constexpr (is_tuple_v<Type> || is_pair_v<Type>)
+        {
+            std::apply([&](const auto &...aObjects) { (EncodeObject(aBytes, aObjects), ...); }, aObject);
+        }
+        else if constexpr (is_basic_string_v<Type> && sizeof(typename Type::value_type) == sizeof(uint8_t))
+        {
+            // the characters of strings are compared as unsigned
+            for (const auto character : aObject)
+            {
+                aBytes.push_back(static_cast<uint8_t>(character));
+                if (!aBytes.back())
+                {
+                    aBytes.push_back(0xFF);
+                }
+            }
+
+            // the terminator sorts before the escaped 0 of a longer string
+            aBytes.insert(aBytes.end(), {0, 0});
+        }
+        else if constexpr (std::ranges::range<Type>)
+        {
+            for (const auto &object : aObject)
+            {
+                aBytes.push_back(1);
+                EncodeObject(aBytes, object);
+            }
+
+            aBytes.push_back(0);
+        }
+        else
+        {
+            static_assert(always_false<Type>, "Type can't be encoded in an ordered key!");
+        }
+    }
+
+    template <typename Type> [[nodiscard]] static consteval auto FindSignBit() noexcept
+    {
+        using TypeUnsigned = std::make_unsigned_t<Type>;
+        return static_cast<TypeUnsigned>(TypeUnsigned{1} << (std::numeric_limits<TypeUnsigned>::digits - 1));
+    }
+
+    template <typename Type> static constexpr void EncodeUnsigned(std::vector<uint8_t> &aBytes, const Type aObject)
+    {
+        for (auto i = static_cast<int>(sizeof(Type)) - 1; i >= 0; i--)
+        {
+            aBytes.push_back(static_cast<uint8_t>(aObject >> i * 8));
+        }
+    }
+};
+} // namespace hbann
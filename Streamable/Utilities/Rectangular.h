@@ -0,0 +1,127 @@
+/*
+    Copyright (c) 2024 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma once
+
+#include "SizeFinder.h"
+
+namespace hbann
+{
+/*
+    Marks a range of ranges (ex.: std::vector<std::vector<double>>) whose rows have the same count
+
+    It's written as its shape followed by the elements of the rows, without a count per row, so it can be read back in
+    place or flat in a Dense array. Ex.: mStreamWriter.WriteAll(hbann::Rectangular(mMatrix));
+*/
+template <typename Type> class Rectangular
+{
+    static_assert(SizeFinder::FindRangeRank<Type>(), "Type is not a range!");
+
+  public:
+    static constexpr auto rank = SizeFinder::FindRangeRank<Type>();
+
+    using range_type = Type;
+    using value_type = typename decltype(SizeFinder::FindRangeElement<Type>())::type;
+    using shape_type = std::array<Size::size_max, rank>;
+
+    constexpr explicit Rectangular(Type &aRange) noexcept : mRange(&aRange)
+    {
+    }
+
+    // the rows are checked while finding the shape so a jagged range can't be read back wrong
+    [[nodiscard]] constexpr shape_type FindShape() const
+    {
+        shape_type shape{};
+        FindShape(*mRange, shape);
+
+        if (!IsShape(*mRange, shape))
+        {
+            throw std::out_of_range("The range is not rectangular!");
+        }
+
+        return shape;
+    }
+
+    constexpr void Reshape(const shape_type &aShape)
+    {
+        Reshape(*mRange, aShape);
+    }
+
+    // calls aFunction with every row of the last dimension, they are contiguous
+    template <typename Function> constexpr void ForEachRow(Function &&aFunction) const
+    {
+        ForEachRow(*mRange, aFunction);
+    }
+
+  private:
+    Type *mRange{};
+
+    template <size_t vDimension = 0, typename Range>
+    static constexpr void FindShape(const Range &aRange, shape_type &aShape) noexcept
+    {
+        aShape[vDimension] = SizeFinder::GetRangeCount(aRange);
+        if constexpr (vDimension + 1 < rank)
+        {
+            if (aShape[vDimension])
+            {
+                FindShape<vDimension + 1>(*std::ranges::begin(aRange), aShape);
+            }
+        }
+    }
+
+    template <size_t vDimension = 0, typename Range>
+    [[nodiscard]] static constexpr bool IsShape(const Range &aRange, const shape_type &aShape) noexcept
+    {
+        if (SizeFinder::GetRangeCount(aRange) != aShape[vDimension])
+        {
+            return false;
+        }
+
+        if constexpr (vDimension + 1 < rank)
+        {
+            return std::ranges::all_of(aRange, [&](const auto &aRow) { return IsShape<vDimension + 1>(aRow, aShape); });
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    template <size_t vDimension = 0, typename Range>
+    static constexpr void Reshape(Range &aRange, const shape_type &aShape)
+    {
+        static_assert(has_method_resize<Range>, "The ranges of a rectangular range must be resizable!");
+
+        aRange.resize(aShape[vDimension]);
+        if constexpr (vDimension + 1 < rank)
+        {
+            for (auto &row : aRange)
+            {
+                Reshape<vDimension + 1>(row, aShape);
+            }
+        }
+    }
+
+    template <size_t vDimension = 0, typename Range, typename Function>
+    static constexpr void ForEachRow(Range &aRange, Function &aFunction)
+    {
+        if constexpr (vDimension + 1 < rank)
+        {
+            for (auto &row : aRange)
+            {
+                ForEachRow<vDimension + 1>(row, aFunction);
+            }
+        }
+        else
+        {
+            static_assert(std::ranges::contiguous_range<Range> && is_known_size<range_value_t<Range>>,
+                          "The rows of a rectangular range must be contiguous and of objects of known size!");
+
+            aFunction(aRange);
+        }
+    }
+};
+} // namespace hbann
@@ -0,0 +1,523 @@
+/*
+    Copyright (c) 2024 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma once
+
+namespace hbann
+{
+/*
+    Binds the fields of an aggregate with structured bindings, so it can be (de)serialized without a macro
+
+    The aggregate must not have bases or C arrays as fields, they can't be counted right.
+*/
+class Reflector
+{
+  public:
+    // the fields of a record (streamable, class with fields or aggregate) in the order they are written
+    template <typename TypeRecord> [[nodiscard]] static constexpr auto TieFields(TypeRecord &aRecord)
+    {
+        if constexpr (std::derived_from<TypeRecord, IStreamable>)
+        {
+            return aRecord.StreamableColumns();
+        }
+        else if constexpr (has_streamable_fields<TypeRecord>)
+        {
+            return StreamableFields(aRecord);
+        }
+        else if constexpr (is_reflectable<TypeRecord>)
+        {
+            return Tie(aRecord);
+        }
+        else
+        {
+            static_assert(always_false<TypeRecord>, "The records must be streamables, have fields or be aggregates!");
+        }
+    }
+
+    template <typename Type> [[nodiscard]] static consteval size_t FindFieldCount() noexcept
+    {
+        return detail::find_field_count<std::remove_cv_t<Type>>();
+    }
+
+    // a tuple of references to the fields of the aggregate
+    template <typename Type> [[nodiscard]] static constexpr auto Tie(Type &aObject) noexcept
+    {
+        constexpr auto count = FindFieldCount<Type>();
+        static_assert(count && count <= REFLECTABLE_FIELDS_MAX, "Type has no fields or too many to be reflected!");
+
+        if constexpr (count == 1)
+        {
+            auto &[o1] = aObject;
+            return std::tie(o1);
+        }
+        else if constexpr (count == 2)
+        {
+            auto &[o1, o2] = aObject;
+            return std::tie(o1, o2);
+        }
+        else if constexpr (count == 3)
+        {
+            auto &[o1, o2, o3] = aObject;
+            return std::tie(o1, o2, o3);
+        }
+        else if constexpr (count == 4)
+        {
+            auto &[o1, o2, o3, o4] = aObject;
+            return std::tie(o1, o2, o3, o4);
+        }
+        else if constexpr (count == 5)
+        {
+            auto &[o1, o2, o3, o4, o5] = aObject;
+            return std::tie(o1, o2, o3, o4, o5);
+        }
+        else if constexpr (count == 6)
+        {
+            auto &[o1, o2, o3, o4, o5, o6] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6);
+        }
+        else if constexpr (count == 7)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7);
+        }
+        else if constexpr (count == 8)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8);
+        }
+        else if constexpr (count == 9)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9);
+        }
+        else if constexpr (count == 10)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10);
+        }
+        else if constexpr (count == 11)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11);
+        }
+        else if constexpr (count == 12)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12);
+        }
+        else if constexpr (count == 13)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13);
+        }
+        else if constexpr (count == 14)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14);
+        }
+        else if constexpr (count == 15)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15);
+        }
+        else if constexpr (count == 16)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16);
+        }
+        else if constexpr (count == 17)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17);
+        }
+        else if constexpr (count == 18)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18);
+        }
+        else if constexpr (count == 19)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19);
+        }
+        else if constexpr (count == 20)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20);
+        }
+        else if constexpr (count == 21)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                   o21] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21);
+        }
+        else if constexpr (count == 22)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21,
+                   o22] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22);
+        }
+        else if constexpr (count == 23)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23);
+        }
+        else if constexpr (count == 24)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24);
+        }
+        else if constexpr (count == 25)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25);
+        }
+        else if constexpr (count == 26)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26);
+        }
+        else if constexpr (count == 27)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27);
+        }
+        else if constexpr (count == 28)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28);
+        }
+        else if constexpr (count == 29)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29);
+        }
+        else if constexpr (count == 30)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30);
+        }
+        else if constexpr (count == 31)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31);
+        }
+        else if constexpr (count == 32)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32);
+        }
+        else if constexpr (count == 33)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33);
+        }
+        else if constexpr (count == 34)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34);
+        }
+        else if constexpr (count == 35)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35);
+        }
+        else if constexpr (count == 36)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36);
+        }
+        else if constexpr (count == 37)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37);
+        }
+        else if constexpr (count == 38)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38);
+        }
+        else if constexpr (count == 39)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39);
+        }
+        else if constexpr (count == 40)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40);
+        }
+        else if constexpr (count == 41)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40,
+                   o41] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41);
+        }
+        else if constexpr (count == 42)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41,
+                   o42] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42);
+        }
+        else if constexpr (count == 43)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43);
+        }
+        else if constexpr (count == 44)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44);
+        }
+        else if constexpr (count == 45)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45);
+        }
+        else if constexpr (count == 46)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46);
+        }
+        else if constexpr (count == 47)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47);
+        }
+        else if constexpr (count == 48)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48);
+        }
+        else if constexpr (count == 49)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49);
+        }
+        else if constexpr (count == 50)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50);
+        }
+        else if constexpr (count == 51)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51);
+        }
+        else if constexpr (count == 52)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52);
+        }
+        else if constexpr (count == 53)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53);
+        }
+        else if constexpr (count == 54)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54);
+        }
+        else if constexpr (count == 55)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55);
+        }
+        else if constexpr (count == 56)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56);
+        }
+        else if constexpr (count == 57)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57);
+        }
+        else if constexpr (count == 58)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58);
+        }
+        else if constexpr (count == 59)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59);
+        }
+        else if constexpr (count == 60)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60);
+        }
+        else if constexpr (count == 61)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60,
+                   o61] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60, o61);
+        }
+        else if constexpr (count == 62)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61,
+                   o62] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60, o61, o62);
+        }
+        else if constexpr (count == 63)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62,
+                   o63] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60, o61, o62, o63);
+        }
+        else if constexpr (count == 64)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62,
+                   o63, o64] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60, o61, o62, o63, o64);
+        }
+    }
+};
+} // namespace hbann
@@ -42,7 +42,7 @@ class Size
         if (aSize)
         {
             // add the bits required to represent the size
-            requiredBits += static_cast<size_max>(std::log2(aSize));
+            requiredBits += static_cast<size_max>(std::bit_width(aSize)) - 1;
         }
 
         // add the bits required to represent the required bytes to store the final value
@@ -59,75 +59,73 @@ class Size
         return (requiredBits + 7) / 8;
     }
 
-    [[nodiscard]] static inline auto MakeSize(const size_max aSize) noexcept
+    [[nodiscard]] static constexpr auto MakeSize(const size_max aSize) noexcept
     {
-        thread_local uint8_t SIZE_AS_CHARS[SIZE_MAX_IN_BYTES]{};
-        auto &SIZE = *reinterpret_cast<size_max *>(SIZE_AS_CHARS);
-
         const auto requiredBytes = FindRequiredBytes(aSize);
-        auto SIZE_AS_CHARS_START = SIZE_AS_CHARS + (SIZE_MAX_IN_BYTES - requiredBytes);
 
-        // write the size itself
-        SIZE = ToBigEndian(aSize);
+        Bytes size{};
+        size.mCount = requiredBytes;
+
+        // write the size itself in big endian
+        for (size_max i = 0; i < requiredBytes; i++)
+        {
+            size.mBytes[i] = static_cast<uint8_t>(aSize >> ((requiredBytes - 1 - i) * 8));
+        }
+
         // write the 3 bits representing the bytes required
         if constexpr (SIZE_MAX_IN_BYTES == 4)
         {
-            *SIZE_AS_CHARS_START |= requiredBytes << 6;
+            size.mBytes.front() |= requiredBytes << 6;
         }
         else
         {
-            *SIZE_AS_CHARS_START |= requiredBytes << 5;
+            size.mBytes.front() |= requiredBytes << 5;
         }
 
-        // return the last 'requiredBytes' from SIZE
-        return span{SIZE_AS_CHARS_START, requiredBytes};
+        return size;
     }
 
-    [[nodiscard]] static inline auto MakeSize(const span aSize) noexcept
+    [[nodiscard]] static constexpr size_max MakeSize(const span aSize) noexcept
     {
-        uint8_t SIZE_AS_CHARS[SIZE_MAX_IN_BYTES]{};
-        auto &SIZE = *reinterpret_cast<size_max *>(SIZE_AS_CHARS);
+        const auto requiredBytes = FindRequiredBytes(aSize.front());
 
-        size_max requiredBytes{};
+        // clear the required bytes
+        size_max size{};
         if constexpr (SIZE_MAX_IN_BYTES == 4)
         {
-            requiredBytes = static_cast<size_max>(aSize.front() >> 6);
+            size = aSize.front() & 0b00111111;
         }
         else
         {
-            requiredBytes = static_cast<size_max>(aSize.front() >> 5);
+            size = aSize.front() & 0b00011111;
         }
 
-        auto SIZE_AS_CHARS_START = SIZE_AS_CHARS + (SIZE_MAX_IN_BYTES - requiredBytes);
-        // copy only the resizeable size
-        std::memcpy(SIZE_AS_CHARS_START, aSize.data(), requiredBytes);
-
-        // clear the required bytes
-        if constexpr (SIZE_MAX_IN_BYTES == 4)
-        {
-            *SIZE_AS_CHARS_START &= 0b00111111;
-        }
-        else
+        // read the rest of the size in big endian
+        for (size_max i = 1; i < requiredBytes; i++)
         {
-            *SIZE_AS_CHARS_START &= 0b00011111;
+            size = (size << 8) | aSize[i];
         }
 
-        return ToBigEndian(SIZE);
+        return size;
     }
 
-  private:
-    static inline constexpr auto SIZE_MAX_IN_BYTES = sizeof(size_max);
-
-    [[nodiscard]] static constexpr size_max ToBigEndian(const size_max aSize) noexcept
+    // the bytes of a size are kept by value so it can be made at compile time too
+    class Bytes
     {
-        if constexpr (std::endian::native == std::endian::little)
-        {
-            return ByteSwap(aSize);
-        }
-        else
+        friend class Size;
+
+      public:
+        [[nodiscard]] constexpr operator span() const noexcept
         {
-            return aSize;
+            return {mBytes.data(), mCount};
         }
-    }
+
+      private:
+        std::array<uint8_t, sizeof(size_max)> mBytes{};
+        size_max mCount{};
+    };
+
+  private:
+    static inline constexpr auto SIZE_MAX_IN_BYTES = sizeof(size_max);
 };
 } // namespace hbann
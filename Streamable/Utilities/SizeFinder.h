@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "Reflector.h"
 #include "Size.h"
 
 namespace hbann
@@ -17,9 +18,10 @@ class SizeFinder
     {
         using TypeRaw = std::remove_cvref_t<Type>;
 
-        if constexpr (std::ranges::range<TypeRaw>)
+        // fixed extents are not prefixed by a count, they are part of their elements
+        if constexpr (std::ranges::range<TypeRaw> && !is_fixed_extent<TypeRaw>)
         {
-            return 1 + FindRangeRank<typename TypeRaw::value_type>();
+            return 1 + FindRangeRank<range_value_t<TypeRaw>>();
         }
         else
         {
@@ -27,6 +29,121 @@ class SizeFinder
         }
     }
 
+    // the alignment of an object in an aligned stream, only the objects of known size are copied as they are
+    template <typename Type> [[nodiscard]] static consteval size_t FindAlignment() noexcept
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        if constexpr (is_known_size<TypeRaw>)
+        {
+            return std::min(alignof(TypeRaw), ALIGNMENT_MAX);
+        }
+        else
+        {
+            return 1;
+        }
+    }
+
+    // the encoded strings are written as bytes
+    template <typename Type> [[nodiscard]] static consteval size_t FindRangeAlignment() noexcept
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        if constexpr (is_wide_string<TypeRaw> || is_path<TypeRaw>)
+        {
+            return 1;
+        }
+        else
+        {
+            return FindAlignment<range_value_t<TypeRaw>>();
+        }
+    }
+
+    // the type of the objects in the ranges of the last dimension, wrapped in a std::type_identity
+    template <typename Type> [[nodiscard]] static consteval auto FindRangeElement() noexcept
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        if constexpr (FindRangeRank<TypeRaw>())
+        {
+            return FindRangeElement<range_value_t<TypeRaw>>();
+        }
+        else
+        {
+            return std::type_identity<TypeRaw>{};
+        }
+    }
+
+    // the least bytes an object of type Type is written in, so counts asking for more than there is can be rejected
+    template <typename Type> [[nodiscard]] static consteval Size::size_max FindMinSize() noexcept
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        if constexpr (is_optional_v<TypeRaw> || is_variant_v<TypeRaw>)
+        {
+            return 1;
+        }
+        else if constexpr (is_tuple_v<TypeRaw>)
+        {
+            return []<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                return (Size::size_max{} + ... + FindMinSize<std::tuple_element_t<vIndexes, TypeRaw>>());
+            }(std::make_index_sequence<std::tuple_size_v<TypeRaw>>{});
+        }
+        else if constexpr (is_pair_v<TypeRaw>)
+        {
+            return FindMinSize<typename TypeRaw::first_type>() + FindMinSize<typename TypeRaw::second_type>();
+        }
+        else if constexpr (has_streamable_fields<TypeRaw>)
+        {
+            return FindMinSize<decltype(StreamableFields(std::declval<TypeRaw &>()))>();
+        }
+        else if constexpr (is_reflectable<TypeRaw>)
+        {
+            return FindMinSize<decltype(Reflector::Tie(std::declval<TypeRaw &>()))>();
+        }
+        else if constexpr (is_any_pointer<TypeRaw>)
+        {
+            // shared objects written before are only a reference to them
+            return std::min<Size::size_max>(1, FindMinSize<typename std::pointer_traits<TypeRaw>::element_type>());
+        }
+        else if constexpr (is_known_size<TypeRaw>)
+        {
+            return sizeof(TypeRaw);
+        }
+        else if constexpr (is_fixed_array<TypeRaw>)
+        {
+            using TypeValueType = range_value_t<TypeRaw>;
+            return sizeof(TypeRaw) / sizeof(TypeValueType) * FindMinSize<TypeValueType>();
+        }
+        else
+        {
+            // ranges and streamables start with a count
+            return 1;
+        }
+    }
+
+    // the count of the leading objects of known size, they can be written and read as a single block
+    template <typename... Types> [[nodiscard]] static consteval size_t FindKnownSizeRun() noexcept
+    {
+        size_t run{};
+        for (const auto knownSize : {is_known_size<std::remove_cvref_t<Types>>...})
+        {
+            if (!knownSize)
+            {
+                break;
+            }
+
+            run++;
+        }
+
+        return run;
+    }
+
+    template <typename... Types> [[nodiscard]] static consteval size_t FindOptionalCount() noexcept
+    {
+        return (size_t{} + ... + is_optional_v<std::remove_cvref_t<Types>>);
+    }
+
     template <std::ranges::range Range>
     [[nodiscard]] static constexpr Size::size_max GetRangeCount(const Range &aRange) noexcept
     {
@@ -0,0 +1,131 @@
+/*
+    Copyright (c) 2024 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma once
+
+#include "SizeFinder.h"
+
+namespace hbann
+{
+/*
+    Format: a tagged field is a key followed by the field, the key is a size made of the field id and the wire kind
+
+    The id is a 16 bits hash of the field name, the wire kind is the last 3 bits and it tells how the field can be
+   skipped: fixed fields are 1, 2, 4 or 8 bytes long, delimited fields are prefixed by their size in bytes.
+*/
+class Tag
+{
+  public:
+    using id = uint16_t;
+
+    enum class Kind : uint8_t
+    {
+        FIXED_1,
+        FIXED_2,
+        FIXED_4,
+        FIXED_8,
+        DELIMITED
+    };
+
+    // the ids of the names of the fields separated by commas, as the macros stringify them
+    template <size_t vCount> [[nodiscard]] static consteval auto FindIds(const std::string_view aNames)
+    {
+        std::array<id, vCount> ids{};
+
+        size_t index{};
+        for (const auto name : std::views::split(aNames, ','))
+        {
+            ids[index++] = FindId(Trim(std::string_view(name.begin(), name.end())));
+        }
+
+        // a renamed field is another field, but two fields must not hash the same
+        for (size_t i = 0; i < vCount; i++)
+        {
+            for (size_t j = i + 1; j < vCount; j++)
+            {
+                if (ids[i] == ids[j])
+                {
+                    throw std::out_of_range("Two fields have the same tag id, rename one of them!");
+                }
+            }
+        }
+
+        return ids;
+    }
+
+    template <typename Type> [[nodiscard]] static consteval Kind FindKind() noexcept
+    {
+        if constexpr (is_known_size<Type> && sizeof(Type) == 1)
+        {
+            return Kind::FIXED_1;
+        }
+        else if constexpr (is_known_size<Type> && sizeof(Type) == 2)
+        {
+            return Kind::FIXED_2;
+        }
+        else if constexpr (is_known_size<Type> && sizeof(Type) == 4)
+        {
+            return Kind::FIXED_4;
+        }
+        else if constexpr (is_known_size<Type> && sizeof(Type) == 8)
+        {
+            return Kind::FIXED_8;
+        }
+        else
+        {
+            return Kind::DELIMITED;
+        }
+    }
+
+    [[nodiscard]] static constexpr Size::size_max FindFixedSize(const Kind aKind) noexcept
+    {
+        return Size::size_max{1} << static_cast<uint8_t>(aKind);
+    }
+
+    [[nodiscard]] static constexpr Size::size_max MakeKey(const id aId, const Kind aKind) noexcept
+    {
+        return Size::size_max{aId} << 3 | static_cast<uint8_t>(aKind);
+    }
+
+    [[nodiscard]] static constexpr id GetId(const Size::size_max aKey) noexcept
+    {
+        return static_cast<id>(aKey >> 3);
+    }
+
+    [[nodiscard]] static constexpr Kind GetKind(const Size::size_max aKey) noexcept
+    {
+        return static_cast<Kind>(aKey & 0b111);
+    }
+
+  private:
+    // FNV-1a folded to 16 bits
+    [[nodiscard]] static consteval id FindId(const std::string_view aName) noexcept
+    {
+        uint32_t hash = 2166136261u;
+        for (const auto character : aName)
+        {
+            hash = (hash ^ static_cast<uint8_t>(character)) * 16777619u;
+        }
+
+        return static_cast<id>(hash ^ hash >> 16);
+    }
+
+    [[nodiscard]] static consteval std::string_view Trim(std::string_view aName) noexcept
+    {
+        while (!aName.empty() && aName.front() == ' ')
+        {
+            aName.remove_prefix(1);
+        }
+
+        while (!aName.empty() && aName.back() == ' ')
+        {
+            aName.remove_suffix(1);
+        }
+
+        return aName;
+    }
+};
+} // namespace hbann
@@ -8,40 +8,35 @@
 
 #include "FWD/StreamableFWD.h"
 
-// native
-#ifdef _WIN32
-
-#ifndef NOIME
-#define NOIME
-#endif // !NOIME
-
-#ifndef NOMCX
-#define NOMCX
-#endif // !NOMCX
-
-#ifndef NOMINMAX
-#define NOMINMAX
-#endif // !NOMINMAX
-
-#ifndef WIN32_LEAN_AND_MEAN
-#define WIN32_LEAN_AND_MEAN
-#endif // !WIN32_LEAN_AND_MEAN
-
-#include <Windows.h>
-
-#else
-#warning "Platform does not support encoding UTF16 strings to save memory!"
+// simd, only the instructions every CPU of the architecture has so no flags are needed
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STREAMABLE_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define STREAMABLE_NEON
+#include <arm_neon.h>
 #endif
 
 // std
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <filesystem>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <memory_resource>
 #include <optional>
+#include <ranges>
 #include <span>
+#include <stdexcept>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -69,6 +64,12 @@
 #define FS_BASE(base) base::FromStream();
 #define FS_BASES(...) EXPAND(PASTE(FS_BASE, __VA_ARGS__))
 
+#define SC_BASE(base) ::hbann::detail::dependent_t<base, TypeSelf>::StreamableColumns(),
+#define SC_BASES(...) EXPAND(PASTE(SC_BASE, __VA_ARGS__))
+
+#define SF_FIELD(field) std::tie(aObject.field),
+#define SF_FIELDS(...) EXPAND(PASTE(SF_FIELD, __VA_ARGS__))
+
 #define STATIC_ASSERT_HAS_ISTREAMABLE_BASE(...)                                                                        \
     static_assert(::hbann::are_derived_from_istreamable<__VA_ARGS__>, "The class must inherit a streamable!");
 
@@ -96,12 +97,22 @@
                                                                                                                        \
     STREAMABLE_RESET_ACCESS_MODIFIER
 
+#define STREAMABLE_DEFINE_COLUMNS_BASES(...)                                                                           \
+  protected:                                                                                                           \
+    template <typename TypeSelf = void> [[nodiscard]] auto StreamableColumnsBases() noexcept                           \
+    {                                                                                                                  \
+        return std::tuple_cat(SC_BASES(__VA_ARGS__) std::tuple<>{});                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
+
 #define STREAMABLE_DEFINE_BASE(...)                                                                                    \
     STATIC_ASSERT_HAS_ISTREAMABLE_BASE(__VA_ARGS__)                                                                    \
     STATIC_ASSERT_DONT_PASS_ISTREAMABLE_AS_BASE(__VA_ARGS__)                                                           \
                                                                                                                        \
     STREAMABLE_DEFINE_TO_STREAM_BASES(__VA_ARGS__)                                                                     \
     STREAMABLE_DEFINE_FROM_STREAM_BASES(__VA_ARGS__)                                                                   \
+    STREAMABLE_DEFINE_COLUMNS_BASES(__VA_ARGS__)                                                                       \
                                                                                                                        \
     STREAMABLE_RESET_ACCESS_MODIFIER
 
@@ -127,21 +138,104 @@
                                                                                                                        \
     STREAMABLE_RESET_ACCESS_MODIFIER
 
+// the fields of the class and of its bases in the order they are written, a template so it's made only when used by
+// ::hbann::Columnar, the bases may not define it
+#define STREAMABLE_DEFINE_COLUMNS(className, ...)                                                                      \
+  protected:                                                                                                           \
+    template <typename TypeSelf = className> [[nodiscard]] auto StreamableColumns() noexcept                           \
+    {                                                                                                                  \
+        return std::tuple_cat(TypeSelf::StreamableColumnsBases(), ::hbann::detail::tie_fields(__VA_ARGS__));           \
+    }                                                                                                                  \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
+
 #define STREAMABLE_DEFINE_INTRUSIVE                                                                                    \
   private:                                                                                                             \
     friend class ::hbann::StreamReader;                                                                                \
-    friend class ::hbann::StreamWriter;
+    friend class ::hbann::StreamWriter;                                                                                \
+    friend class ::hbann::Reflector;
+
+#define STREAMABLE_DEFINE_DERIVED(...)                                                                                 \
+  public:                                                                                                              \
+    using StreamableDerived = std::tuple<__VA_ARGS__>;                                                                 \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
 
 #define STREAMABLE_DEFINE(className, ...)                                                                              \
     STREAMABLE_DEFINE_INTRUSIVE                                                                                        \
                                                                                                                        \
     STREAMABLE_DEFINE_TO_STREAM(className, __VA_ARGS__)                                                                \
     STREAMABLE_DEFINE_FROM_STREAM(className, __VA_ARGS__)                                                              \
+    STREAMABLE_DEFINE_COLUMNS(className, __VA_ARGS__)                                                                  \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
+
+#define STREAMABLE_DEFINE_TAGGED_IDS(...)                                                                              \
+    static constexpr auto streamableIds =                                                                              \
+        ::hbann::Tag::FindIds<std::tuple_size_v<decltype(std::tie(__VA_ARGS__))>>(#__VA_ARGS__);
+
+// like STREAMABLE_DEFINE, but the fields are written with their ids so they can be reordered, removed and added
+#define STREAMABLE_DEFINE_TAGGED(className, ...)                                                                       \
+    STREAMABLE_DEFINE_INTRUSIVE                                                                                        \
+                                                                                                                       \
+  protected:                                                                                                           \
+    void ToStream() override                                                                                           \
+    {                                                                                                                  \
+        className::ToStreamBases();                                                                                    \
+                                                                                                                       \
+        STREAMABLE_DEFINE_TAGGED_IDS(__VA_ARGS__)                                                                      \
+        mStreamWriter.WriteTagged(streamableIds, __VA_ARGS__);                                                         \
+    }                                                                                                                  \
+                                                                                                                       \
+    void FromStream() override                                                                                         \
+    {                                                                                                                  \
+        className::FromStreamBases();                                                                                  \
+                                                                                                                       \
+        STREAMABLE_DEFINE_TAGGED_IDS(__VA_ARGS__)                                                                      \
+        mStreamReader.ReadTagged(streamableIds, __VA_ARGS__);                                                          \
+    }                                                                                                                  \
+                                                                                                                       \
+    STREAMABLE_DEFINE_COLUMNS(className, __VA_ARGS__)                                                                  \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
+
+// like STREAMABLE_DEFINE, but the optionals are written as a bitmap of their presence followed by their values
+#define STREAMABLE_DEFINE_SPARSE(className, ...)                                                                       \
+    STREAMABLE_DEFINE_INTRUSIVE                                                                                        \
+                                                                                                                       \
+  protected:                                                                                                           \
+    void ToStream() override                                                                                           \
+    {                                                                                                                  \
+        className::ToStreamBases();                                                                                    \
+                                                                                                                       \
+        mStreamWriter.WriteSparse(__VA_ARGS__);                                                                        \
+    }                                                                                                                  \
+                                                                                                                       \
+    void FromStream() override                                                                                         \
+    {                                                                                                                  \
+        className::FromStreamBases();                                                                                  \
+                                                                                                                       \
+        mStreamReader.ReadSparse(__VA_ARGS__);                                                                         \
+    }                                                                                                                  \
+                                                                                                                       \
+    STREAMABLE_DEFINE_COLUMNS(className, __VA_ARGS__)                                                                  \
                                                                                                                        \
     STREAMABLE_RESET_ACCESS_MODIFIER
 
+// used outside of the class, in its namespace, the public fields are written one after another without any state
+#define STREAMABLE_DEFINE_FIELDS(className, ...)                                                                       \
+    template <typename Type>                                                                                           \
+        requires std::same_as<std::remove_const_t<Type>, className>                                                    \
+    [[nodiscard]] constexpr auto StreamableFields(Type &aObject) noexcept                                              \
+    {                                                                                                                  \
+        return std::tuple_cat(SF_FIELDS(__VA_ARGS__) std::tuple<>{});                                                  \
+    }
+
 namespace hbann
 {
+// the rank is a size_t, that is not declared yet in the forward declarations
+template <typename, size_t> class Dense;
+
 namespace detail
 {
 template <typename> struct is_pair : std::false_type
@@ -168,7 +262,8 @@ template <typename... Types> struct is_variant<std::variant<Types...>> : std::tr
 template <typename> struct is_unique_ptr : std::false_type
 {
 };
-template <typename Type> struct is_unique_ptr<std::unique_ptr<Type>> : std::true_type
+template <typename Type, typename TypeDeleter>
+struct is_unique_ptr<std::unique_ptr<Type, TypeDeleter>> : std::true_type
 {
 };
 
@@ -192,8 +287,107 @@ template <typename> struct is_basic_string : std::false_type
 template <typename... Types> struct is_basic_string<std::basic_string<Types...>> : std::true_type
 {
 };
+
+template <typename Container> struct range_value
+{
+    using type = std::ranges::range_value_t<Container>;
+};
+// containers name their element (a path iterates over paths, but it's made of characters) and views don't
+template <typename Container>
+    requires requires { typename Container::value_type; }
+struct range_value<Container>
+{
+    using type = typename Container::value_type;
+};
+
+template <typename> struct is_std_array : std::false_type
+{
+};
+template <typename Type, size_t vSize> struct is_std_array<std::array<Type, vSize>> : std::true_type
+{
+};
+
+template <typename> struct is_span : std::false_type
+{
+};
+template <typename Type, size_t vExtent> struct is_span<std::span<Type, vExtent>> : std::true_type
+{
+};
+
+template <typename> struct is_dense : std::false_type
+{
+};
+template <typename Type, size_t vRank> struct is_dense<Dense<Type, vRank>> : std::true_type
+{
+};
+
+template <typename> struct is_rectangular : std::false_type
+{
+};
+template <typename Type> struct is_rectangular<Rectangular<Type>> : std::true_type
+{
+};
+
+template <typename> struct is_columnar : std::false_type
+{
+};
+template <typename Type> struct is_columnar<Columnar<Type>> : std::true_type
+{
+};
+
+// delays the lookup in Type until TypeDependent is known
+template <typename Type, typename TypeDependent> struct dependent
+{
+    using type = Type;
+};
+
+template <typename Type, typename TypeDependent> using dependent_t = typename dependent<Type, TypeDependent>::type;
+
+// like std::tie, but the temporaries passed to the macros (ex.: hbann::Rectangular) are kept by value
+template <typename... Types> [[nodiscard]] constexpr auto tie_fields(Types &&...aObjects) noexcept
+{
+    return std::tuple<Types...>(std::forward<Types>(aObjects)...);
+}
+
+// converts to any field of an aggregate, so we can count them by how many of it initialize the aggregate
+template <typename TypeAggregate> struct any_field
+{
+    template <typename Type>
+        requires(!std::is_same_v<Type, TypeAggregate>)
+    operator Type() const noexcept;
+};
+
+template <typename Type, typename... Fields> [[nodiscard]] consteval size_t find_field_count() noexcept
+{
+    if constexpr (requires { Type{Fields{}..., any_field<Type>{}}; })
+    {
+        return find_field_count<Type, Fields..., any_field<Type>>();
+    }
+    else
+    {
+        return sizeof...(Fields);
+    }
+}
+
+// like find_field_count, but the fields are initialized from braces so the elements of arrays are not counted
+template <typename Type, typename... Fields> [[nodiscard]] consteval size_t find_field_count_braced() noexcept
+{
+    if constexpr (requires { Type{{Fields{}}..., {any_field<Type>{}}}; })
+    {
+        return find_field_count_braced<Type, Fields..., any_field<Type>>();
+    }
+    else
+    {
+        return sizeof...(Fields);
+    }
+}
 } // namespace detail
 
+template <typename Type> inline constexpr bool is_std_array_v = detail::is_std_array<Type>::value;
+template <typename Type> inline constexpr bool is_span_v = detail::is_span<Type>::value;
+template <typename Type> inline constexpr bool is_dense_v = detail::is_dense<Type>::value;
+template <typename Type> inline constexpr bool is_rectangular_v = detail::is_rectangular<Type>::value;
+template <typename Type> inline constexpr bool is_columnar_v = detail::is_columnar<Type>::value;
 template <typename Type> inline constexpr bool is_pair_v = detail::is_pair<Type>::value;
 template <typename Type> inline constexpr bool is_tuple_v = detail::is_tuple<Type>::value;
 template <typename Type> inline constexpr bool is_variant_v = detail::is_variant<Type>::value;
@@ -202,6 +396,8 @@ template <typename Type> inline constexpr bool is_unique_ptr_v = detail::is_uniq
 template <typename Type> inline constexpr bool is_shared_ptr_v = detail::is_shared_ptr<Type>::value;
 template <typename Type> inline constexpr bool is_basic_string_v = detail::is_basic_string<Type>::value;
 
+template <typename Container> using range_value_t = typename detail::range_value<Container>::type;
+
 template <typename> inline constexpr auto always_false = false;
 
 template <typename Type>
@@ -213,6 +409,16 @@ concept is_u16string = std::is_same_v<typename Type::value_type, std::u16string:
 template <typename Type>
 concept is_utf16string = is_u16string<Type> || (sizeof(std::wstring::value_type) == 2 && is_wstring<Type>);
 
+template <typename Type>
+concept is_u32string = std::is_same_v<typename Type::value_type, std::u32string::value_type> && is_basic_string_v<Type>;
+
+template <typename Type>
+concept is_utf32string = is_u32string<Type> || (sizeof(std::wstring::value_type) == 4 && is_wstring<Type>);
+
+// the strings written in UTF-8, their count is in bytes
+template <typename Type>
+concept is_wide_string = is_utf16string<Type> || is_utf32string<Type>;
+
 template <typename Type>
 concept is_smart_pointer = is_shared_ptr_v<Type> || is_unique_ptr_v<Type>;
 
@@ -231,38 +437,102 @@ template <typename... Types>
 concept are_same_as_istreamable = (std::is_same_v<Types, IStreamable> || ...);
 
 template <typename Type>
-concept is_standard_layout_no_pointer = std::is_standard_layout_v<Type> && !is_any_pointer<Type>;
+concept has_streamable_derived = is_tuple_v<typename Type::StreamableDerived>;
+
+// the customization point of classes that don't inherit a streamable, it returns a tuple of references to the fields
+template <typename Type>
+concept has_streamable_fields =
+    requires(Type &aObject) { requires is_tuple_v<decltype(StreamableFields(aObject))>; };
+
+// the most fields Reflector can bind
+inline constexpr size_t REFLECTABLE_FIELDS_MAX = 64;
+
+// the most an aligned stream aligns its objects to, the nested streams start at it
+inline constexpr size_t ALIGNMENT_MAX = alignof(std::max_align_t);
+
+// aggregates that can't be copied as bytes are written field by field, without listing them in a macro
+template <typename Type>
+concept is_reflectable = std::is_aggregate_v<Type> && !std::is_array_v<Type> && !std::is_trivially_copyable_v<Type> &&
+                         !std::ranges::range<Type> && !has_streamable_fields<Type> &&
+                         detail::find_field_count<Type>() > 0 &&
+                         detail::find_field_count<Type>() <= REFLECTABLE_FIELDS_MAX;
+
+// written as their shape followed by their elements
+template <typename Type>
+concept is_shaped = is_dense_v<Type> || is_rectangular_v<Type>;
+
+// spans, shaped arrays and columns are standard layout, but they point to their elements
+// aggregates whose fields can be bound, the counts differ for arrays and for fields ambiguous to initialize from braces
+template <typename Type>
+concept is_bindable = std::is_aggregate_v<Type> && !std::is_array_v<Type> && detail::find_field_count<Type>() > 0 &&
+                      detail::find_field_count<Type>() == detail::find_field_count_braced<Type>();
+
+template <typename Type>
+concept is_standard_layout_no_pointer = std::is_standard_layout_v<Type> && !is_any_pointer<Type> && !is_span_v<Type> &&
+                                        !is_shaped<Type> && !is_columnar_v<Type> && !has_streamable_fields<Type> &&
+                                        !is_reflectable<Type>;
+
+// arrays know their count, so they are written without one
+template <typename Type>
+concept is_fixed_array = std::is_bounded_array_v<Type> || is_std_array_v<Type>;
+
+template <typename Type>
+concept is_fixed_extent = is_fixed_array<Type> || (is_span_v<Type> && Type::extent != std::dynamic_extent);
 
 template <typename Type>
 concept is_path = std::is_same_v<Type, std::filesystem::path>;
 
+template <typename Type> [[nodiscard]] consteval bool find_known_size() noexcept
+{
+    if constexpr (is_fixed_array<Type>)
+    {
+        return find_known_size<std::ranges::range_value_t<Type>>();
+    }
+    else
+    {
+        return is_standard_layout_no_pointer<Type> && !is_optional_v<Type> && !is_variant_v<Type> &&
+               !is_tuple_v<Type> && !is_pair_v<Type> && !std::ranges::range<Type> &&
+               !std::derived_from<Type, IStreamable>;
+    }
+}
+
+// the objects written as their bytes, it mirrors the branches of the writer and the reader
+template <typename Type>
+concept is_known_size = find_known_size<Type>();
+
 template <typename Container>
 concept is_range_standard_layout =
-    (std::ranges::contiguous_range<Container> && is_standard_layout_no_pointer<typename Container::value_type>) ||
+    (std::ranges::contiguous_range<Container> && std::ranges::sized_range<Container> &&
+     is_standard_layout_no_pointer<range_value_t<Container>>) ||
     is_path<Container>;
 
 template <typename Container>
 concept has_method_size = requires(Container &aContainer) { std::ranges::size(aContainer); };
 
+template <typename Container>
+concept has_method_reserve = requires(Container &aContainer) { aContainer.reserve(std::size_t{}); };
+
+template <typename Container>
+concept has_method_resize = requires(Container &aContainer) { aContainer.resize(std::size_t{}); };
+
+// their order depends on the hashes and the history of the container
+template <typename Container>
+concept is_unordered = std::ranges::range<Container> && requires { typename Container::hasher; };
+
+// the elements that changed are written one by one in a delta, the strings are written whole
+template <typename Container>
+concept is_patchable = std::ranges::random_access_range<Container> && std::ranges::sized_range<Container> &&
+                       has_method_resize<Container> && !is_basic_string_v<Container>;
+
+template <typename Container>
+concept has_method_emplace_hint = requires(Container &aContainer, typename Container::value_type &&aObject) {
+    aContainer.emplace_hint(std::ranges::cend(aContainer), std::move(aObject));
+};
+
 [[nodiscard]] consteval bool static_equal(const auto &aString1, const auto &aString2) noexcept
 {
     return *aString1 == *aString2 && (!*aString1 || static_equal(aString1 + 1, aString2 + 1));
 }
-
-template <typename Type, std::size_t vIndex = 0>
-[[nodiscard]] constexpr Type variant_from_index(const std::size_t aIndex)
-{
-    static_assert(is_variant_v<Type>, "Type is not a variant!");
-
-    if constexpr (vIndex < std::variant_size_v<Type>)
-    {
-        return aIndex ? variant_from_index<Type, vIndex + 1>(aIndex - 1) : Type{std::in_place_index<vIndex>};
-    }
-    else
-    {
-        throw std::out_of_range("Out of bounds variant index!");
-    }
-}
 } // namespace hbann
 
 /*
@@ -272,8 +542,4 @@ template <typename Type, std::size_t vIndex = 0>
 
     FEATURES:
          - instead of reading object to jump over the value, create a jump method
-
-    UX:
-         - when finding derived class from base class pointer, add a tuple representing the types that can be read
-   and make the user access the objects by index so can't read a bad object
 */
@@ -1,2 +1 @@
 #include "pch.h"
-#include "Forwards.h"
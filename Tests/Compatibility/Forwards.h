@@ -1 +1,91 @@
 #pragma once
+
+struct t1 : public hbann::IStreamable
+{
+    STREAMABLE_DEFINE_TAGGED(t1, a, b, c)
+
+  public:
+    int a{};
+    std::string b{};
+    double c{};
+};
+
+struct t2 : public hbann::IStreamable
+{
+    STREAMABLE_DEFINE_TAGGED(t2, d, c, a)
+
+  public:
+    std::vector<int> d{};
+    double c{};
+    int a{};
+};
+
+struct t3 : public hbann::IStreamable
+{
+    STREAMABLE_DEFINE_TAGGED(t3, a, b)
+
+  public:
+    int64_t a{};
+    std::string b{};
+};
+
+TEST_CASE("Compatibility::Forwards", "[Compatibility][Forwards]")
+{
+    SECTION("Tagged Reordered/Removed/Added")
+    {
+        t1 t1;
+        t2 t2;
+
+        t1.a = 420;
+        t1.b = "69";
+        t1.c = 4.20;
+
+        t2.Deserialize(t1.Serialize());
+        REQUIRE(t2.a == t1.a);
+        REQUIRE(t2.c == t1.c);
+        REQUIRE(t2.d.empty());
+
+        t2.a = 69;
+        t2.c = 6.9;
+        t2.d = {4, 2, 0};
+
+        t1.Deserialize(t2.Serialize());
+        REQUIRE(t1.a == t2.a);
+        REQUIRE(t1.b == "69");
+        REQUIRE(t1.c == t2.c);
+    }
+
+    SECTION("Tagged Type Changed")
+    {
+        t1 t1;
+        t3 t3;
+
+        t1.a = 420;
+        t1.b = "69";
+
+        // the type of 'a' changed, so it's skipped like an unknown field
+        t3.a = 1;
+        t3.Deserialize(t1.Serialize());
+        REQUIRE(t3.a == 1);
+        REQUIRE(t3.b == t1.b);
+    }
+
+    SECTION("Tagged Aligned")
+    {
+        hbann::StreamContext context(hbann::StreamContext::Option::ALIGNED);
+        t1 t1;
+        t2 t2, t2End;
+
+        t2.a = 69;
+        t2.c = 6.9;
+        t2.d = {4, 2, 0};
+
+        // the delimited fields are padded like nested streams, skipping them skips their padding too
+        t1.Deserialize(t2.Serialize(context));
+        REQUIRE(t1.a == t2.a);
+        REQUIRE(t1.c == t2.c);
+
+        t2End.Deserialize(t2.Serialize(context));
+        REQUIRE(t2End.d == t2.d);
+    }
+}
@@ -79,4 +79,606 @@ TEST_CASE("Streamable::Independent::Streams", "[Streamable][Independent][Streams
         REQUIRE(d == dd);
         REQUIRE(s == ss);
     }
+
+    SECTION("StreamReader Known Size Runs")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        int i = 1;
+        double d = 2.5;
+        char c = '3';
+        streamWriter.WriteAll(i, d, c, std::string("4"), i, c);
+        REQUIRE(stream.View().size() == 2 * sizeof(i) + sizeof(d) + 2 * sizeof(c) + 2);
+
+        // the last run is longer than what was written, it's read one by one like an older version
+        int ii{};
+        double dd{};
+        char cc{};
+        std::string ss{};
+        int iii{};
+        char ccc{};
+        int iiii = 5;
+        streamReader.ReadAll(ii, dd, cc, ss, iii, ccc, iiii);
+
+        REQUIRE(std::tie(ii, dd, cc, ss, iii, ccc, iiii) == std::tuple{i, d, c, "4", i, c, 5});
+
+        // a run bigger than the stack
+        using Block = std::array<uint8_t, 1 << 22>;
+        auto blocks = std::make_unique<std::array<Block, 2>>();
+        (*blocks)[0].fill(6);
+        (*blocks)[1].fill(7);
+
+        hbann::Stream streamBlocks;
+        hbann::StreamWriter(streamBlocks).WriteAll((*blocks)[0], (*blocks)[1]);
+
+        REQUIRE(streamBlocks.View().size() == 2 * sizeof(Block));
+        REQUIRE(std::ranges::equal(streamBlocks.View().first(sizeof(Block)), (*blocks)[0]));
+        REQUIRE(std::ranges::equal(streamBlocks.View().last(sizeof(Block)), (*blocks)[1]));
+    }
+
+    SECTION("StreamReader Truncated")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        streamWriter.WriteAll(std::vector<int>{1, 2, 3}, int16_t{4});
+
+        hbann::Stream streamTruncated(stream.View().first(stream.View().size() - 1));
+        hbann::StreamReader streamTruncatedReader(streamTruncated);
+
+        std::vector<int> v{};
+        int i{};
+        REQUIRE_THROWS_AS(streamTruncatedReader.ReadAll(v, i), std::out_of_range);
+        REQUIRE(v == std::vector<int>{1, 2, 3});
+
+        // reading past the end is how older versions are read, the objects are left untouched
+        int16_t ii = 5;
+        streamReader.ReadAll(v, ii, i);
+        REQUIRE(ii == 4);
+        REQUIRE(i == 0);
+    }
+
+    SECTION("StreamReader Ranges")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        std::unordered_map<int, std::string> um{{1, "one"}, {2, "two"}, {3, "three"}};
+        std::map<std::string, int> m{{"a", 1}, {"b", 2}, {"c", 3}};
+        std::set<int> s{5, 3, 1, 4, 2};
+        std::vector<std::list<int>> vl{{1, 2}, {3}, {}};
+        streamWriter.WriteAll(um, m, s, vl);
+
+        std::unordered_map<int, std::string> umm{};
+        std::map<std::string, int> mm{};
+        std::set<int> ss{};
+        std::vector<std::list<int>> vvl{};
+        streamReader.ReadAll(umm, mm, ss, vvl);
+
+        REQUIRE(um == umm);
+        REQUIRE(m == mm);
+        REQUIRE(s == ss);
+        REQUIRE(vl == vvl);
+        REQUIRE(vvl.capacity() == vl.size());
+    }
+
+    SECTION("StreamReader Reuse")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        std::vector<std::string> vs{"quadriceps", "", "gastrocnemius"};
+        std::optional<std::string> o{};
+        std::variant<int, std::string> v{"biceps"};
+        streamWriter.WriteAll(vs, o, v);
+
+        std::vector<std::string> vvs(5, std::string(64, 'x'));
+        std::optional<std::string> oo{"soleus"};
+        std::variant<int, std::string> vv{std::string(64, 'x')};
+        const auto vvStringCapacity = std::get<std::string>(vv).capacity();
+        const auto vvsData = vvs.data();
+        const auto vvsCapacity = vvs.capacity();
+        const auto vvsFrontCapacity = vvs.front().capacity();
+        streamReader.ReadAll(vvs, oo, vv);
+
+        REQUIRE(vs == vvs);
+        REQUIRE(o == oo);
+        REQUIRE(v == vv);
+        REQUIRE(std::get<std::string>(vv).capacity() == vvStringCapacity);
+        REQUIRE(vvs.data() == vvsData);
+        REQUIRE(vvs.capacity() == vvsCapacity);
+        REQUIRE(vvs.front().capacity() == vvsFrontCapacity);
+    }
+
+    SECTION("StreamReader Each")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        std::vector<int> v{4, 8, 15, 16, 23, 42};
+        std::list<std::string> l{"deltoid", "trapezius"};
+        streamWriter.WriteAll(v, l);
+
+        int sum{};
+        streamReader.ReadEach<int>([&](int aValue) { sum += aValue; });
+        REQUIRE(sum == 108);
+
+        std::vector<std::string> vs{};
+        streamReader.ReadEach<std::string>(std::back_inserter(vs));
+        REQUIRE(std::ranges::equal(l, vs));
+    }
+
+    SECTION("StreamWriter Views")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        std::vector<int> v{1, 2, 3, 4, 5, 6};
+        std::istringstream istream("7 8 9");
+        streamWriter.WriteAll(v | std::views::transform([](int aValue) { return std::to_string(aValue); }),
+                              v | std::views::filter([](int aValue) { return aValue % 2; }),
+                              std::ranges::istream_view<int>(istream), std::span(v).subspan(4));
+
+        std::vector<std::string> vs{};
+        std::list<int> l{};
+        std::vector<int> vi{};
+        std::vector<int> vii{};
+        streamReader.ReadAll(vs, l, vi, vii);
+
+        REQUIRE(vs == std::vector<std::string>{"1", "2", "3", "4", "5", "6"});
+        REQUIRE(l == std::list<int>{1, 3, 5});
+        REQUIRE(vi == std::vector<int>{7, 8, 9});
+        REQUIRE(vii == std::vector<int>{5, 6});
+    }
+
+    SECTION("StreamWriter Fixed Extents")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        std::vector<std::array<float, 3>> points{{1.f, 2.f, 3.f}, {4.f, 5.f, 6.f}};
+        int matrix[2][2]{{1, 2}, {3, 4}};
+        std::array<std::string, 2> names{"x", "yz"};
+        streamWriter.WriteAll(points, matrix, names);
+
+        // a single count for the points, the arrays themselves have none
+        REQUIRE(stream.View().size() == 1 + sizeof(float) * 6 + sizeof(matrix) + (1 + 1) + (1 + 2));
+
+        std::vector<std::array<float, 3>> pointsEnd{};
+        int matrixEnd[2][2]{};
+        std::array<std::string, 2> namesEnd{};
+        streamReader.ReadAll(pointsEnd, matrixEnd, namesEnd);
+
+        REQUIRE(points == pointsEnd);
+        REQUIRE(std::ranges::equal(matrix | std::views::join, matrixEnd | std::views::join));
+        REQUIRE(names == namesEnd);
+
+        // spans of fixed extent are written like the arrays they point to
+        hbann::Stream streamSpan;
+        hbann::StreamWriter(streamSpan).WriteAll(std::span<float, 3>(points.back()));
+        std::array<float, 3> point{};
+        hbann::StreamReader(streamSpan).ReadAll(point);
+
+        REQUIRE(point == points.back());
+    }
+
+    SECTION("StreamWriter Rectangular")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        std::vector<std::vector<double>> matrix{{1., 2., 3.}, {4., 5., 6.}};
+        streamWriter.WriteAll(hbann::Rectangular(matrix));
+
+        // the shape is written once, without a count per row
+        REQUIRE(stream.View().size() == 2 + sizeof(double) * 6);
+
+        std::vector<std::vector<double>> matrixEnd{};
+        streamReader.ReadAll(hbann::Rectangular(matrixEnd));
+
+        REQUIRE(matrix == matrixEnd);
+
+        // the same bytes can be read in a flat buffer
+        hbann::Stream streamDense;
+        hbann::StreamWriter(streamDense).WriteAll(hbann::Rectangular(matrix));
+
+        hbann::Dense<double, 2> dense{};
+        hbann::StreamReader(streamDense).ReadAll(dense);
+
+        REQUIRE(dense.GetShape() == std::array<hbann::Size::size_max, 2>{2, 3});
+        REQUIRE(dense(1, 2) == 6.);
+
+        dense(0, 0) = 7.;
+        streamDense = {};
+        hbann::StreamWriter(streamDense).WriteAll(dense);
+        hbann::StreamReader(streamDense).ReadAll(hbann::Rectangular(matrixEnd));
+
+        REQUIRE(matrixEnd[0][0] == 7.);
+
+        // the extents after a zero one don't need any bytes
+        hbann::Stream streamEmpty;
+        hbann::Dense<double, 2> denseEmpty({1000, 0});
+        std::vector<std::vector<double>> matrixEmpty(1000);
+        hbann::StreamWriter(streamEmpty).WriteAll(denseEmpty, hbann::Rectangular(matrixEmpty));
+
+        hbann::Dense<double, 2> denseEmptyEnd{};
+        std::vector<std::vector<double>> matrixEmptyEnd{};
+        hbann::StreamReader(streamEmpty).ReadAll(denseEmptyEnd, hbann::Rectangular(matrixEmptyEnd));
+
+        REQUIRE(denseEmpty == denseEmptyEnd);
+        REQUIRE(matrixEmpty == matrixEmptyEnd);
+
+        // a product of the extents that overflows
+        hbann::Stream streamOverflow;
+        streamOverflow.Write(hbann::Size::MakeSize(hbann::Size::size_max{1} << 40));
+        streamOverflow.Write(hbann::Size::MakeSize(hbann::Size::size_max{1} << 40));
+        REQUIRE_THROWS_AS(hbann::StreamReader(streamOverflow).ReadAll(denseEmptyEnd), std::out_of_range);
+
+        matrix.back().pop_back();
+        REQUIRE_THROWS_AS(streamWriter.WriteAll(hbann::Rectangular(matrix)), std::out_of_range);
+    }
+
+    SECTION("StreamWriter Columnar")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        std::vector<Sample> samples{{1, 10}, {2, 20}, {3, 30}};
+        streamWriter.WriteAll(hbann::Columnar(samples));
+
+        // a count and a block per column
+        REQUIRE(stream.View().size() == 1 + sizeof(uint8_t) * 3 + sizeof(uint32_t) * 3);
+
+        std::vector<uint8_t> channels{};
+        std::vector<uint32_t> values{};
+        streamReader.ReadAll(hbann::Columnar(std::tie(channels, values)));
+
+        REQUIRE(channels == std::vector<uint8_t>{1, 2, 3});
+        REQUIRE(values == std::vector<uint32_t>{10, 20, 30});
+
+        // streamables have the columns of their bases too
+        std::vector<Circle> circles{{GUID_RND, "svg", "url", std::vector{1., 2.}}, {GUID_RND, {}, "url2", true}};
+
+        hbann::Stream streamCircles;
+        hbann::StreamWriter(streamCircles).WriteAll(hbann::Columnar(circles));
+
+        std::vector<Circle> circlesEnd{};
+        hbann::StreamReader(streamCircles).ReadAll(hbann::Columnar(circlesEnd));
+
+        REQUIRE(circles == circlesEnd);
+
+        values.pop_back();
+        REQUIRE_THROWS_AS(streamWriter.WriteAll(hbann::Columnar(std::tie(channels, values))), std::out_of_range);
+    }
+
+    SECTION("StreamWriter Delta")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        const Measurement measurementBaseline{"mV", {{1, 100}, {2, 200}, {3, 300}}};
+        auto measurement = measurementBaseline;
+        measurement.samples[1].value = 250;
+        measurement.samples.push_back({4, 400});
+        streamWriter.WriteDelta(measurement, measurementBaseline);
+
+        // the bitmap, the count of samples and the ones that changed with their indexes
+        REQUIRE(stream.View().size() == 1 + 1 + 1 + 2 * (1 + sizeof(uint8_t) + sizeof(uint32_t)));
+
+        auto measurementEnd = measurementBaseline;
+        streamReader.ReadDelta(measurementEnd);
+
+        REQUIRE(measurement == measurementEnd);
+
+        // the padding of objects of known size is not compared
+        struct Point
+        {
+            uint8_t flags;
+            uint32_t value;
+        };
+        struct Track
+        {
+            std::string name;
+            std::vector<Point> points;
+            Point last;
+        };
+
+        Track trackZeroed{"track", std::vector<Point>(2), {}};
+        Track trackPadded = trackZeroed;
+        std::memset(trackZeroed.points.data(), 0, 2 * sizeof(Point));
+        std::memset(trackPadded.points.data(), 0xFF, 2 * sizeof(Point));
+        std::memset(&trackZeroed.last, 0, sizeof(Point));
+        std::memset(&trackPadded.last, 0xFF, sizeof(Point));
+        for (auto track : {&trackZeroed, &trackPadded})
+        {
+            for (uint8_t i = 0; i < 2; i++)
+            {
+                track->points[i].flags = i;
+                track->points[i].value = i * 10u;
+            }
+
+            track->last.flags = 2;
+            track->last.value = 20;
+        }
+
+        hbann::Stream streamPadded;
+        hbann::StreamWriter(streamPadded).WriteDelta(trackPadded, std::as_const(trackZeroed));
+
+        REQUIRE(streamPadded.View().size() == 1);
+
+        // streamables have the fields of their bases too, a baseline kept encoded is decoded first
+        Circle circleBaseline(GUID_RND, "svg", "url", std::vector{1., 2.});
+        Circle circle(GUID_RND, "svg", "url2", std::vector{1., 2.});
+        auto streamBaseline = circleBaseline.Serialize();
+
+        Circle circleDecoded;
+        circleDecoded.Deserialize(std::move(streamBaseline));
+
+        hbann::Stream streamCircle;
+        hbann::StreamWriter(streamCircle).WriteDelta(circle, std::as_const(circleDecoded));
+
+        REQUIRE(streamCircle.View().size() == 1 + 1 + 4);
+
+        auto circleEnd = circleBaseline;
+        hbann::StreamReader(streamCircle).ReadDelta(circleEnd);
+
+        REQUIRE(circle == circleEnd);
+
+        // an element after the count of samples
+        hbann::Stream streamInvalid;
+        streamInvalid.Write(std::array<uint8_t, 1>{0b10});
+        for (auto i = 0; i < 3; i++)
+        {
+            streamInvalid.Write(hbann::Size::MakeSize(1));
+        }
+        streamInvalid.Write(std::array<uint8_t, sizeof(uint8_t) + sizeof(uint32_t)>{});
+
+        REQUIRE_THROWS_AS(hbann::StreamReader(streamInvalid).ReadDelta(measurementEnd), std::out_of_range);
+    }
+
+    SECTION("StreamWriter Arrays")
+    {
+        using Handshake = std::tuple<uint32_t, std::string, std::optional<double>, std::vector<int16_t>>;
+
+        constexpr auto handshake = hbann::StreamWriter::WriteArray<[] {
+            return Handshake{0xCAFE, "hello", 2.5, {1, 2, 3}};
+        }>();
+        static_assert(handshake.size() == sizeof(uint32_t) + 1 + 5 + 1 + sizeof(double) + 1 + 3 * sizeof(int16_t));
+        static_assert(hbann::StreamReader::ReadArray<Handshake>(handshake) ==
+                      Handshake{0xCAFE, "hello", 2.5, {1, 2, 3}});
+
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        streamWriter.WriteAll(Handshake{0xCAFE, "hello", 2.5, {1, 2, 3}});
+
+        REQUIRE(std::ranges::equal(stream.View(), handshake));
+        REQUIRE(hbann::StreamReader::ReadArray<Handshake>(handshake) == Handshake{0xCAFE, "hello", 2.5, {1, 2, 3}});
+    }
+
+    SECTION("StreamWriter Fields")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        std::vector<Measurement> measurements{{"mV", {{1, 100}, {2, 200}}}, {"mA", {}}};
+        streamWriter.WriteAll(measurements);
+
+        // the fields are written without padding or sizes
+        REQUIRE(stream.View().size() == 1 + (1 + 2) + 1 + 2 * (sizeof(uint8_t) + sizeof(uint32_t)) + (1 + 2) + 1);
+
+        std::vector<Measurement> measurementsEnd{};
+        streamReader.ReadAll(measurementsEnd);
+
+        REQUIRE(measurements == measurementsEnd);
+    }
+
+    SECTION("StreamWriter Aggregates")
+    {
+        hbann::Stream stream;
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        static_assert(hbann::Reflector::FindFieldCount<Reading>() == 4);
+
+        std::vector<Reading> readings{{"thermometer", 36.6, std::vector{36, 37}, {1, 366}},
+                                      {"barometer", 1013., {}, {}}};
+        std::map<int, Reading> readingsById{{7, readings.front()}};
+        streamWriter.WriteAll(readings, readingsById);
+
+        std::vector<Reading> readingsEnd{};
+        std::map<int, Reading> readingsByIdEnd{};
+        streamReader.ReadAll(readingsEnd, readingsByIdEnd);
+
+        REQUIRE(readings == readingsEnd);
+        REQUIRE(readingsById == readingsByIdEnd);
+    }
+
+    SECTION("Stream Cached")
+    {
+        Document document{};
+        document.mName = "report";
+        document.mParagraphs.resize(2);
+        document.mParagraphs[0].SetTitle("intro");
+        document.mParagraphs[1].SetTitle("results");
+
+        auto streamClean = document.Serialize();
+        const auto stream = streamClean.View();
+        REQUIRE(std::ranges::none_of(document.mParagraphs, [](auto &aParagraph) { return aParagraph.IsDirty(); }));
+
+        // a change that is not marked is not seen, the cached encoding is copied
+        document.mParagraphs[1].mValues.push_back(7);
+        REQUIRE(std::ranges::equal(document.Serialize().View(), stream));
+
+        document.mParagraphs[1].MarkDirty();
+        auto streamDirty = document.Serialize();
+        REQUIRE(!std::ranges::equal(streamDirty.View(), stream));
+
+        Document documentEnd{};
+        documentEnd.Deserialize(std::move(streamDirty));
+
+        REQUIRE(document == documentEnd);
+        REQUIRE(documentEnd.mParagraphs[1].IsDirty());
+
+        // deserializing through the base marks it too, the next encoding is not the stale one
+        [[maybe_unused]] auto streamEnd = documentEnd.Serialize();
+        Paragraph paragraph{};
+        paragraph.SetTitle("conclusion");
+        hbann::IStreamable &paragraphBase = documentEnd.mParagraphs[0];
+        paragraphBase.Deserialize(paragraph.Serialize());
+
+        REQUIRE(documentEnd.mParagraphs[0].IsDirty());
+        REQUIRE(documentEnd.mParagraphs[0] == paragraph);
+
+        [[maybe_unused]] auto streamBase = documentEnd.Serialize();
+        REQUIRE(paragraphBase.TryDeserialize(document.mParagraphs[1].Serialize()));
+        REQUIRE(documentEnd.mParagraphs[0].IsDirty());
+
+        Document documentBase{};
+        documentBase.Deserialize(documentEnd.Serialize());
+        REQUIRE(documentBase == documentEnd);
+        REQUIRE(documentBase.mParagraphs[0] == document.mParagraphs[1]);
+
+        // shared pointers written by identity depend on the objects before them, so nothing is cached
+        hbann::StreamContext context(hbann::StreamContext::Option::IDENTITY);
+        document.mParagraphs[0].MarkDirty();
+        [[maybe_unused]] auto streamIdentity = document.Serialize(context);
+
+        REQUIRE(document.mParagraphs[0].IsDirty());
+    }
+
+    SECTION("Stream Identity")
+    {
+        hbann::StreamContext context(hbann::StreamContext::Option::IDENTITY);
+        hbann::Stream stream(context);
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        auto material = std::make_shared<std::string>("marble");
+        auto circle = std::make_shared<Sphere>(Circle(), std::make_unique<bool>(true),
+                                               std::tuple<std::string, std::list<int>>{}, std::pair<Circle, double>{});
+        std::vector<std::shared_ptr<std::string>> materials(100, material);
+        std::vector<std::shared_ptr<Circle>> circles{circle, circle};
+        streamWriter.WriteAll(materials, circles);
+
+        std::vector<std::shared_ptr<std::string>> materialsEnd{};
+        std::vector<std::shared_ptr<Circle>> circlesEnd{};
+        streamReader.ReadAll(materialsEnd, circlesEnd);
+
+        REQUIRE(materialsEnd.size() == materials.size());
+        REQUIRE(*materialsEnd.front() == *material);
+        REQUIRE(std::ranges::all_of(materialsEnd, [&](auto &aMaterial) { return aMaterial == materialsEnd.front(); }));
+        REQUIRE(circlesEnd.front() == circlesEnd.back());
+        REQUIRE(typeid(*circlesEnd.front()) == typeid(Sphere));
+
+        // a back reference to an object of another type
+        hbann::StreamContext contextAlias(hbann::StreamContext::Option::IDENTITY);
+        hbann::Stream streamAlias(contextAlias);
+        hbann::StreamWriter(streamAlias).WriteAll(material);
+        streamAlias.Write(hbann::Size::MakeSize(1));
+
+        std::shared_ptr<std::string> materialEnd{};
+        std::shared_ptr<std::vector<double>> alias{};
+        REQUIRE_THROWS_AS(hbann::StreamReader(streamAlias).ReadAll(materialEnd, alias), std::out_of_range);
+    }
+
+    SECTION("Stream Canonical")
+    {
+        hbann::StreamContext context(hbann::StreamContext::Option::CANONICAL);
+
+        // the same elements inserted in another order, and with rehashes in between
+        std::unordered_map<std::string, double> map1{}, map2{};
+        for (int i = 0; i < 100; i++)
+        {
+            map1.emplace(std::to_string(i), i ? i : -0.);
+        }
+        for (int i = 99; i >= 0; i--)
+        {
+            map2.emplace(std::to_string(i), i ? i : 0.);
+        }
+        map2.rehash(1024);
+
+        hbann::Stream stream1(context), stream2(context);
+        hbann::StreamWriter(stream1).WriteAll(map1);
+        hbann::StreamWriter(stream2).WriteAll(map2);
+
+        REQUIRE(std::ranges::equal(stream1.View(), stream2.View()));
+
+        std::unordered_map<std::string, double> mapEnd{};
+        hbann::StreamReader(stream1).ReadAll(mapEnd);
+
+        REQUIRE(mapEnd == map2);
+
+        // the floating points of known size aggregates are normalized and their padding is zeroed
+        struct Range
+        {
+            float low;
+            float high;
+        };
+        struct Probe
+        {
+            char tag;
+            double value;
+            Range range;
+        };
+
+        alignas(Probe) std::array<uint8_t, sizeof(Probe)> memory1{}, memory2{};
+        memory2.fill(0xFF);
+        const auto sample1 = new (memory1.data()) Probe{'s', 0., {1.f, 0.f}};
+        const auto sample2 = new (memory2.data()) Probe{'s', -0., {1.f, -0.f}};
+        std::vector<Probe> samples1{*sample1}, samples2{*sample2};
+
+        hbann::Stream streamSample1(context), streamSample2(context);
+        hbann::StreamWriter(streamSample1).WriteAll(*sample1, *sample1, samples1);
+        hbann::StreamWriter(streamSample2).WriteAll(*sample2, *sample2, samples2);
+
+        REQUIRE(std::ranges::equal(streamSample1.View(), streamSample2.View()));
+
+        // classes whose fields can't be found are rejected instead of written with their padding
+        class Measure
+        {
+            [[maybe_unused]] char mUnit{};
+            [[maybe_unused]] double mValue{};
+        };
+
+        hbann::Stream streamMeasure(context);
+        REQUIRE_THROWS_AS(hbann::StreamWriter(streamMeasure).WriteAll(Measure{}), std::invalid_argument);
+    }
+
+    SECTION("Stream Aligned")
+    {
+        hbann::StreamContext context(hbann::StreamContext::Option::ALIGNED);
+        hbann::Stream stream(context);
+        hbann::StreamWriter streamWriter(stream);
+        hbann::StreamReader streamReader(stream);
+
+        uint8_t flags = 7;
+        std::vector<double> values{1., 2., 3.};
+        std::vector<Circle> circles{{GUID_RND, "svg", "url", std::vector{1., 2.}}};
+        streamWriter.WriteAll(flags, values, circles);
+
+        // the flags and the count are padded to the alignment of the values
+        REQUIRE(std::ranges::all_of(stream.View().subspan(2, 6), [](const auto aByte) { return !aByte; }));
+
+        uint8_t flagsEnd{};
+        std::span<const double> valuesEnd{};
+        std::vector<Circle> circlesEnd{};
+        streamReader.ReadAll(flagsEnd, valuesEnd, circlesEnd);
+
+        REQUIRE(flags == flagsEnd);
+        REQUIRE(valuesEnd.data() == reinterpret_cast<const double *>(stream.View().data() + 8));
+        REQUIRE(std::ranges::equal(values, valuesEnd));
+        REQUIRE(circles == circlesEnd);
+    }
 }
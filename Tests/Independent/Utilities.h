@@ -43,4 +43,90 @@ TEST_CASE("Streamable::Independent::Utilities", "[Streamable][Independent][Utili
             }
         }
     }
+
+    SECTION("Key")
+    {
+        using record = std::tuple<int, std::string, double, std::optional<uint8_t>>;
+
+        const auto encode = [](const record &aRecord) {
+            return std::apply([](const auto &...aFields) { return hbann::Key::Encode(aFields...); }, aRecord);
+        };
+
+        std::vector<record> records{{-1, "b", 1.5, {}}, {-1, "b", -0.5, 2},       {3, "", 0., {}},
+                                    {-1, "ab", 1e10, 1}, {3, {"\0", 1}, 0., {}},   {-200, "zz", -1e10, 0},
+                                    {3, "a", -0., 3},   {-1, "b", 1.5, 1}};
+
+        std::vector<std::vector<uint8_t>> keys{};
+        std::ranges::transform(records, std::back_inserter(keys), encode);
+
+        // the encodings are sorted like the records
+        std::ranges::sort(records);
+        std::ranges::sort(keys);
+
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            REQUIRE(keys[i] == encode(records[i]));
+        }
+
+        // a string followed by more fields sorts before a longer one that starts with it
+        using namespace std::string_literals;
+        REQUIRE(hbann::Key::Encode("ab"s, uint8_t{0xFF}, uint8_t{1}) <
+                hbann::Key::Encode("ab\0"s, uint8_t{0}, uint8_t{0}));
+        REQUIRE(hbann::Key::Encode("ab"s, uint8_t{0xFF}) < hbann::Key::Encode("abc"s, uint8_t{0}));
+
+        REQUIRE(hbann::Key::Encode(-0.) == hbann::Key::Encode(0.));
+    }
+
+    SECTION("Converter")
+    {
+        // the ASCII runs are longer than a vector so the vectorized copies and the tails are both used
+        const std::u16string u16{u"The quick brown fox jumps over the lazy dog, é€\U0001F600 and back again!"};
+        const std::u32string u32{U"The quick brown fox jumps over the lazy dog, é€\U0001F600 and back again!"};
+        const std::string u8{"The quick brown fox jumps over the lazy dog, "
+                             "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 and back again!"};
+
+        REQUIRE(hbann::Converter::Encode(u16) == u8);
+        REQUIRE(hbann::Converter::Encode(u32) == u8);
+
+        const auto u8Bytes = std::as_bytes(std::span(u8));
+        const std::span bytes(reinterpret_cast<const uint8_t *>(u8Bytes.data()), u8Bytes.size());
+        REQUIRE(hbann::Converter::Decode<std::u16string>(bytes) == u16);
+        REQUIRE(hbann::Converter::Decode<std::u32string>(bytes) == u32);
+
+        static_assert(hbann::Converter::Encode(std::u32string{U"éa"}) == "\xC3\xA9" "a");
+
+        // code units after 0x7F whose low byte looks like ASCII must not be copied as ASCII
+        const std::u16string u16Wide{u"abcdĀbcdefgh中ijklmnopߐqrstuvwxyz"};
+        const std::u32string u32Wide{U"abcdĀbcdefgh中ijklmnopߐqrstuvwxyz"};
+        const std::string u8Wide{"abcd\xC4\x80" "bcdefgh\xE4\xB8\xAD" "ijklmnop\xDF\x90" "qrstuvwxyz"};
+
+        REQUIRE(hbann::Converter::Encode(u16Wide) == u8Wide);
+        REQUIRE(hbann::Converter::Encode(u32Wide) == u8Wide);
+        REQUIRE(hbann::Converter::Encode(std::wstring{L"abcdĀbcdefgh中ijklmnopߐqrstuvwxyz"}) == u8Wide);
+
+        const std::span bytesWide(reinterpret_cast<const uint8_t *>(u8Wide.data()), u8Wide.size());
+        REQUIRE(hbann::Converter::Decode<std::u16string>(bytesWide) == u16Wide);
+        REQUIRE(hbann::Converter::Decode<std::u32string>(bytesWide) == u32Wide);
+
+        // unpaired surrogates, code points after U+10FFFF, overlong forms and cut sequences are replaced
+        REQUIRE(hbann::Converter::Encode(std::u16string{u'a', 0xD800, u'b', 0xDC00}) ==
+                "a\xEF\xBF\xBD"
+                "b\xEF\xBF\xBD");
+        REQUIRE(hbann::Converter::Encode(std::u32string{0x110000}) == "\xEF\xBF\xBD");
+
+        const std::array<uint8_t, 6> invalid{0xC0, 0x80, 'a', 0xED, 0xA0, 0xE2};
+        REQUIRE(hbann::Converter::Decode<std::u32string>(invalid) == U"��a���");
+
+        // wide strings are written in UTF-8 on every platform
+        hbann::Stream stream;
+        std::wstring wide{L"Sefu la bani é"};
+        hbann::StreamWriter(stream).WriteAll(wide);
+
+        REQUIRE(stream.View().size() == 1 + 13 + 2);
+
+        std::wstring wideEnd{};
+        hbann::StreamReader(stream).ReadAll(wideEnd);
+
+        REQUIRE(wide == wideEnd);
+    }
 }
@@ -40,6 +40,38 @@ TEST_CASE("IStreamable", "[IStreamable]")
         delete circleEnd;
     }
 
+    SECTION("Derived&")
+    {
+        Circle circle(GUID_RND, "SVG", L"URL\\SHIT", std::vector{69., 420.});
+        hbann::Stream streamCircle;
+        hbann::StreamWriter(streamCircle).WriteAll(circle);
+
+        // a member is written by its class, a derived object seen through its base is written whole, not sliced
+        Shape &shape = circle;
+        hbann::Stream streamShape;
+        hbann::StreamWriter(streamShape).WriteAll(shape);
+
+        REQUIRE(std::ranges::equal(streamCircle.View(), streamShape.View()));
+
+        Circle circleEnd;
+        Shape &shapeEnd = circleEnd;
+        hbann::StreamReader(streamShape).ReadAll(shapeEnd);
+
+        REQUIRE(circle == circleEnd);
+
+        // a pointed object is written with the index of its class, so the reader allocates it
+        std::unique_ptr<Circle> circlePtr = std::make_unique<Sphere>(
+            circle, std::make_unique<bool>(true), std::tuple<std::string, std::list<int>>{"Sphere", {1, 2}},
+            std::pair<Circle, double>{circle, 2.});
+        hbann::Stream streamPtr;
+        hbann::StreamWriter(streamPtr).WriteAll(circlePtr);
+
+        std::unique_ptr<Circle> circlePtrEnd{};
+        hbann::StreamReader(streamPtr).ReadAll(circlePtrEnd);
+
+        REQUIRE(*(Sphere *)circlePtr.get() == *(Sphere *)circlePtrEnd.get());
+    }
+
     SECTION("DerivedxN")
     {
         Circle circle(GUID_RND, {}, L"URL\\SHIT", false);
@@ -84,6 +116,226 @@ TEST_CASE("IStreamable", "[IStreamable]")
         contextEnd.Deserialize(contextStart.Serialize());
 
         REQUIRE(contextStart == contextEnd);
+
+        // the factory of the derived streamables reads after the padding of aligned streams too
+        hbann::StreamContext context(hbann::StreamContext::Option::ALIGNED);
+        ::Context contextAligned;
+        contextAligned.Deserialize(contextStart.Serialize(context));
+
+        REQUIRE(contextStart == contextAligned);
+
+        // a shape the factory doesn't know is read as null and skipped
+        std::vector<Shape *> shapesUnknown{new Shape, new Circle(GUID_RND, "SVG", "URL", true)};
+        uint32_t after = 42;
+
+        hbann::Stream streamUnknown;
+        hbann::StreamWriter(streamUnknown).WriteAll(shapesUnknown, after);
+
+        std::vector<Shape *> shapesUnknownEnd{};
+        uint32_t afterEnd{};
+        hbann::StreamReader(streamUnknown).ReadAll(shapesUnknownEnd, afterEnd);
+
+        REQUIRE(shapesUnknownEnd.size() == 2);
+        REQUIRE(!shapesUnknownEnd.front());
+        REQUIRE(*(Circle *)shapesUnknownEnd.back() == *(Circle *)shapesUnknown.back());
+        REQUIRE(after == afterEnd);
+
+        std::ranges::for_each(shapesUnknown, [](auto aShape) { delete aShape; });
+        std::ranges::for_each(shapesUnknownEnd, [](auto aShape) { delete aShape; });
+    }
+
+    SECTION("RegisteredBaseClass*")
+    {
+        Circle circle(GUID_RND, "SVG", L"URL\\SHIT", std::vector{69., 420.});
+
+        std::vector<Gallery::CirclePtr> circles{};
+        circles.push_back(std::make_unique<Circle>(circle));
+        circles.push_back(std::make_unique<Sphere>(circle, std::make_unique<bool>(false),
+                                                   std::tuple<std::string, std::list<int>>{"Sphere", {1, 2}},
+                                                   std::pair<Circle, double>{circle, 69.}));
+
+        Gallery galleryStart(std::move(circles), std::make_shared<Sphere>(circle, std::make_unique<bool>(true),
+                                                                          std::tuple<std::string, std::list<int>>{},
+                                                                          std::pair<Circle, double>{}));
+
+        Gallery galleryEnd;
+        galleryEnd.Deserialize(galleryStart.Serialize());
+
+        REQUIRE(galleryStart == galleryEnd);
+    }
+
+    SECTION("PooledBaseClass*")
+    {
+        Circle circle(GUID_RND, {}, L"URL\\SHIT", false);
+
+        std::vector<Gallery::CirclePtr> circles{};
+        for (size_t i = 0; i < 100; i++)
+        {
+            circles.push_back(std::make_unique<Circle>(circle));
+        }
+
+        Gallery galleryStart(std::move(circles), std::make_shared<Circle>(circle));
+
+        // every pointer must come from the buffer, the null upstream throws otherwise
+        std::vector<std::byte> buffer(1 << 16);
+        std::pmr::monotonic_buffer_resource pool(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+        hbann::StreamContext context(&pool);
+
+        Gallery galleryEnd;
+        auto stream = galleryStart.Serialize();
+        galleryEnd.Deserialize(hbann::Stream(stream.View(), context), false);
+
+        REQUIRE(galleryStart == galleryEnd);
+
+        // raw pointers are deleted by their owner, so they are not taken from the pool
+        std::vector<int *> values{new int(1), new int(2)};
+        hbann::Stream streamValues;
+        hbann::StreamWriter(streamValues).WriteAll(values);
+
+        std::vector<int *> valuesEnd{};
+        hbann::Stream streamValuesEnd(streamValues.View(), context);
+        hbann::StreamReader(streamValuesEnd).ReadAll(valuesEnd);
+
+        REQUIRE(std::ranges::equal(values, valuesEnd, [](auto aValue1, auto aValue2) { return *aValue1 == *aValue2; }));
+        REQUIRE(std::ranges::none_of(valuesEnd, [&](auto aValue) {
+            return (std::byte *)aValue >= buffer.data() && (std::byte *)aValue < buffer.data() + buffer.size();
+        }));
+
+        for (auto value : values)
+        {
+            delete value;
+        }
+        for (auto value : valuesEnd)
+        {
+            delete value;
+        }
+    }
+
+    SECTION("Sparse")
+    {
+        Profile profileStart;
+        profileStart.mName = "Arnold";
+        profileStart.mScore = 6.9;
+        profileStart.mAvatar = "pump.png";
+
+        // 8 optionals share a byte, only the present values follow
+        auto stream = profileStart.Serialize().Release();
+        REQUIRE(stream.size() == (1 + 6) + 1 + sizeof(double) + (1 + 8));
+
+        Profile profileEnd;
+        profileEnd.mEmail = "gym@bro.com";
+        profileEnd.mAvatar = std::string(64, 'x');
+        const auto avatarCapacity = profileEnd.mAvatar->capacity();
+
+        profileEnd.Deserialize(hbann::Stream(stream), false);
+        REQUIRE(profileStart == profileEnd);
+        REQUIRE(profileEnd.mAvatar->capacity() == avatarCapacity);
+    }
+
+    SECTION("TryDeserialize")
+    {
+        Circle circleStart(GUID_RND, "SVG", L"URL\\SHIT", std::vector{69., 420.});
+        auto stream = circleStart.Serialize().Release();
+
+        Circle circleEnd;
+        REQUIRE(circleEnd.TryDeserialize(hbann::Stream(stream)));
+        REQUIRE(circleStart == circleEnd);
+
+        // the variant holds 2 doubles, but only a part of them is left
+        const auto truncated = circleEnd.TryDeserialize(hbann::Stream({stream.data(), stream.size() - 3}));
+        REQUIRE(truncated.status == hbann::StreamContext::Status::INVALID_COUNT);
+        REQUIRE(truncated.offset == stream.size() - 2 * sizeof(double));
+
+        // the variant has only 2 alternatives
+        stream[stream.size() - 2 * sizeof(double) - 2] += 7;
+        const auto invalid = circleEnd.TryDeserialize(hbann::Stream(stream));
+        REQUIRE(invalid.status == hbann::StreamContext::Status::INVALID_INDEX);
+        REQUIRE(invalid.offset == stream.size() - 2 * sizeof(double) - 1);
+
+        // the factory of the derived streamables reads with the context too, so its errors are not thrown
+        hbann::Stream streamPlugin;
+        streamPlugin.Write(hbann::Size::MakeSize(1));
+        streamPlugin.Write(hbann::Size::MakeSize(20));
+
+        Host hostEnd;
+        const auto plugin = hostEnd.TryDeserialize(hbann::Stream(streamPlugin.View()));
+        REQUIRE(plugin.status == hbann::StreamContext::Status::INVALID_COUNT);
+        REQUIRE(plugin.offset == 2);
+        REQUIRE(!hostEnd.mPlugin);
+
+        // the exceptions of the user's code are thrown, and the context throws again afterwards
+        Host hostStart;
+        hostStart.mPlugin = std::make_unique<Plugin>();
+        hostStart.mPlugin->mName = "?";
+        auto streamHost = hostStart.Serialize().Release();
+
+        hbann::StreamContext context;
+        REQUIRE_THROWS_AS(hostEnd.TryDeserialize(hbann::Stream(streamHost, context)), std::invalid_argument);
+        REQUIRE_THROWS_AS(circleEnd.Deserialize(hbann::Stream({stream.data(), stream.size() - 3}, context)),
+                          std::out_of_range);
+    }
+
+    SECTION("TryDeserializeLimits")
+    {
+        Circle circle(GUID_RND, {}, L"URL\\SHIT", false);
+
+        std::vector<Gallery::CirclePtr> circles{};
+        for (size_t i = 0; i < 10; i++)
+        {
+            circles.push_back(std::make_unique<Circle>(circle));
+        }
+
+        Gallery galleryStart(std::move(circles), std::make_shared<Circle>(circle));
+        auto stream = galleryStart.Serialize().Release();
+
+        hbann::StreamContext context;
+        Gallery galleryEnd;
+
+        context.SetLimits({.count = 9});
+        REQUIRE(galleryEnd.TryDeserialize(hbann::Stream(stream, context)).status ==
+                hbann::StreamContext::Status::OVER_LIMIT);
+
+        context.SetLimits({.depth = 0});
+        REQUIRE(galleryEnd.TryDeserialize(hbann::Stream(stream, context)).status ==
+                hbann::StreamContext::Status::OVER_LIMIT);
+
+        context.SetLimits({.bytes = 11 * sizeof(Circle)});
+        REQUIRE(galleryEnd.TryDeserialize(hbann::Stream(stream, context)).status ==
+                hbann::StreamContext::Status::OVER_LIMIT);
+
+        // the circles are in a range of pointers and their SVG is optional
+        context.SetLimits({.depth = 3});
+        REQUIRE(galleryEnd.TryDeserialize(hbann::Stream(stream, context)).status ==
+                hbann::StreamContext::Status::OVER_LIMIT);
+
+        context.SetLimits({.bytes = 1 << 16, .count = 16, .depth = 4});
+        REQUIRE(galleryEnd.TryDeserialize(hbann::Stream(stream, context)));
+        REQUIRE(galleryStart == galleryEnd);
+
+        // objects that hold themselves without being streamables are nested by the stream only
+        hbann::Stream streamNodes(context);
+        Node node{1, {{2, {{3, {}}}}}};
+        hbann::StreamWriter(streamNodes).WriteAll(node);
+
+        Node nodeEnd{};
+        context.SetLimits({.depth = 4});
+        REQUIRE_THROWS_AS(hbann::StreamReader(streamNodes).ReadAll(nodeEnd), std::out_of_range);
+
+        // every read from the start of a stream has the whole budget
+        context.SetLimits({.bytes = 3 * sizeof(Node)});
+        for (size_t i = 0; i < 3; i++)
+        {
+            hbann::Stream streamNode(streamNodes.View(), context);
+            hbann::StreamReader(streamNode).ReadAll(nodeEnd);
+
+            REQUIRE(node == nodeEnd);
+        }
+
+        // a hostile count is rejected before anything is allocated
+        std::vector<std::list<std::string>> hostile{};
+        hbann::Stream streamHostile;
+        streamHostile.Write(hbann::Size::MakeSize(hbann::Size::size_max{1} << 40));
+        REQUIRE_THROWS_AS(hbann::StreamReader(streamHostile).ReadAll(hostile), std::out_of_range);
     }
 }
 
@@ -10,6 +10,70 @@ typedef struct _guid
 
 inline constexpr guid GUID_RND = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
 
+struct Sample
+{
+    uint8_t channel{};
+    uint32_t value{};
+
+    bool operator==(const Sample &) const = default;
+};
+
+STREAMABLE_DEFINE_FIELDS(Sample, channel, value)
+
+struct Measurement
+{
+    std::string unit{};
+    std::vector<Sample> samples{};
+
+    bool operator==(const Measurement &) const = default;
+};
+
+STREAMABLE_DEFINE_FIELDS(Measurement, unit, samples)
+
+struct Reading
+{
+    std::string sensor{};
+    double value{};
+    std::optional<std::vector<int>> history{};
+    Sample sample{};
+
+    bool operator==(const Reading &) const = default;
+};
+
+// holds itself, so its depth comes only from the stream
+struct Node
+{
+    int value{};
+    std::vector<Node> children{};
+
+    bool operator==(const Node &) const = default;
+};
+
+class Profile : public hbann::IStreamable
+{
+    STREAMABLE_DEFINE_SPARSE(Profile, mName, mEmail, mPhone, mAge, mTags, mScore, mCity, mCountry, mAvatar)
+
+  public:
+    std::string mName{};
+    std::optional<std::string> mEmail{};
+    std::optional<std::string> mPhone{};
+    std::optional<uint8_t> mAge{};
+    std::optional<std::vector<std::string>> mTags{};
+    std::optional<double> mScore{};
+    std::optional<std::string> mCity{};
+    std::optional<std::string> mCountry{};
+    std::optional<std::string> mAvatar{};
+
+    bool operator==(const Profile &aProfile) const
+    {
+        return std::tie(mName, mEmail, mPhone, mAge, mTags, mScore, mCity, mCountry, mAvatar) ==
+               std::tie(aProfile.mName, aProfile.mEmail, aProfile.mPhone, aProfile.mAge, aProfile.mTags,
+                        aProfile.mScore, aProfile.mCity, aProfile.mCountry, aProfile.mAvatar);
+    }
+};
+
+class Sphere;
+
 class Shape : public virtual hbann::IStreamable
 {
     STREAMABLE_DEFINE(Shape, mType, mID)
@@ -50,6 +114,7 @@ class Circle : public Shape
 {
     STREAMABLE_DEFINE_BASE(Shape)
     STREAMABLE_DEFINE(Circle, mSVG, mURL, mVariant)
+    STREAMABLE_DEFINE_DERIVED(Circle, Sphere)
 
   public:
     Circle() = default;
@@ -205,3 +270,119 @@ class Context : public hbann::IStreamable
   private:
     std::shared_ptr<std::vector<Shape *>> mShapes{};
 };
+
+class Gallery : public hbann::IStreamable
+{
+    STREAMABLE_DEFINE(Gallery, mCircles, mHighlight)
+
+  public:
+    Gallery() = default;
+    using CirclePtr = std::unique_ptr<Circle, hbann::Deleter<Circle>>;
+
+    Gallery(std::vector<CirclePtr> &&aCircles, std::shared_ptr<Circle> &&aHighlight)
+        : mCircles(std::move(aCircles)), mHighlight(std::move(aHighlight))
+    {
+    }
+
+    bool operator==(const Gallery &aGallery) const
+    {
+        if (mCircles.size() != aGallery.mCircles.size() || !Equals(mHighlight.get(), aGallery.mHighlight.get()))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < mCircles.size(); i++)
+        {
+            if (!Equals(mCircles[i].get(), aGallery.mCircles[i].get()))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+  private:
+    std::vector<CirclePtr> mCircles{};
+    std::shared_ptr<Circle> mHighlight{};
+
+    static bool Equals(const Circle *aCircle1, const Circle *aCircle2)
+    {
+        if (typeid(*aCircle1) != typeid(*aCircle2))
+        {
+            return false;
+        }
+
+        if (typeid(*aCircle1) == typeid(Sphere))
+        {
+            return *(Sphere *)aCircle1 == *(Sphere *)aCircle2;
+        }
+
+        return *aCircle1 == *aCircle2;
+    }
+};
+
+class Paragraph : public hbann::IStreamableCached
+{
+    STREAMABLE_DEFINE(Paragraph, mTitle, mValues)
+
+  public:
+    std::string mTitle{};
+    std::vector<int> mValues{};
+
+    void SetTitle(const std::string &aTitle)
+    {
+        mTitle = aTitle;
+        MarkDirty();
+    }
+
+    bool operator==(const Paragraph &aParagraph) const
+    {
+        return mTitle == aParagraph.mTitle && mValues == aParagraph.mValues;
+    }
+};
+
+class Document : public hbann::IStreamable
+{
+    STREAMABLE_DEFINE(Document, mName, mParagraphs)
+
+  public:
+    std::string mName{};
+    std::vector<Paragraph> mParagraphs{};
+
+    bool operator==(const Document &aDocument) const
+    {
+        return mName == aDocument.mName && mParagraphs == aDocument.mParagraphs;
+    }
+};
+
+class Plugin : public hbann::IStreamable
+{
+    STREAMABLE_DEFINE(Plugin, mName)
+
+  public:
+    std::string mName{};
+
+  private:
+    // the name is read again by the factory, like a type
+    static hbann::IStreamable *FindDerivedStreamable(hbann::StreamReader &aStreamReader)
+    {
+        std::string name{};
+        aStreamReader.ReadAll(name);
+
+        if (name == "?")
+        {
+            throw std::invalid_argument("The plugin is not installed!");
+        }
+
+        return name.empty() ? nullptr : new Plugin;
+    }
+};
+
+class Host : public hbann::IStreamable
+{
+    STREAMABLE_DEFINE(Host, mPlugin)
+
+  public:
+    std::unique_ptr<Plugin> mPlugin{};
+};
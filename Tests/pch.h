@@ -13,3 +13,7 @@ using namespace Catch;
 // Test
 #include <iostream>
 #include <list>
+#include <map>
+#include <set>
+#include <sstream>
+#include <unordered_map>
@@ -24,49 +24,52 @@
 
 namespace hbann
 {
+template <typename> class Columnar;
 class Converter;
+template <typename> class Deleter;
 class IStreamable;
+class IStreamableCached;
+template <typename> class Rectangular;
+class Key;
+class Reflector;
 class Size;
 class SizeFinder;
 class Stream;
+class StreamContext;
 class StreamReader;
 class StreamWriter;
+class Tag;
 } // namespace hbann
 
-// native
-#ifdef _WIN32
-
-#ifndef NOIME
-#define NOIME
-#endif // !NOIME
-
-#ifndef NOMCX
-#define NOMCX
-#endif // !NOMCX
-
-#ifndef NOMINMAX
-#define NOMINMAX
-#endif // !NOMINMAX
-
-#ifndef WIN32_LEAN_AND_MEAN
-#define WIN32_LEAN_AND_MEAN
-#endif // !WIN32_LEAN_AND_MEAN
-
-#include <Windows.h>
-
-#else
-#warning "Platform does not support encoding UTF16 strings to save memory!"
+// simd, only the instructions every CPU of the architecture has so no flags are needed
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STREAMABLE_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define STREAMABLE_NEON
+#include <arm_neon.h>
 #endif
 
 // std
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <filesystem>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <memory_resource>
 #include <optional>
+#include <ranges>
 #include <span>
+#include <stdexcept>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -94,6 +97,12 @@ class StreamWriter;
 #define FS_BASE(base) base::FromStream();
 #define FS_BASES(...) EXPAND(PASTE(FS_BASE, __VA_ARGS__))
 
+#define SC_BASE(base) ::hbann::detail::dependent_t<base, TypeSelf>::StreamableColumns(),
+#define SC_BASES(...) EXPAND(PASTE(SC_BASE, __VA_ARGS__))
+
+#define SF_FIELD(field) std::tie(aObject.field),
+#define SF_FIELDS(...) EXPAND(PASTE(SF_FIELD, __VA_ARGS__))
+
 #define STATIC_ASSERT_HAS_ISTREAMABLE_BASE(...)                                                                        \
     static_assert(::hbann::are_derived_from_istreamable<__VA_ARGS__>, "The class must inherit a streamable!");
 
@@ -121,12 +130,22 @@ class StreamWriter;
                                                                                                                        \
     STREAMABLE_RESET_ACCESS_MODIFIER
 
+#define STREAMABLE_DEFINE_COLUMNS_BASES(...)                                                                           \
+  protected:                                                                                                           \
+    template <typename TypeSelf = void> [[nodiscard]] auto StreamableColumnsBases() noexcept                           \
+    {                                                                                                                  \
+        return std::tuple_cat(SC_BASES(__VA_ARGS__) std::tuple<>{});                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
+
 #define STREAMABLE_DEFINE_BASE(...)                                                                                    \
     STATIC_ASSERT_HAS_ISTREAMABLE_BASE(__VA_ARGS__)                                                                    \
     STATIC_ASSERT_DONT_PASS_ISTREAMABLE_AS_BASE(__VA_ARGS__)                                                           \
                                                                                                                        \
     STREAMABLE_DEFINE_TO_STREAM_BASES(__VA_ARGS__)                                                                     \
     STREAMABLE_DEFINE_FROM_STREAM_BASES(__VA_ARGS__)                                                                   \
+    STREAMABLE_DEFINE_COLUMNS_BASES(__VA_ARGS__)                                                                       \
                                                                                                                        \
     STREAMABLE_RESET_ACCESS_MODIFIER
 
@@ -152,21 +171,104 @@ class StreamWriter;
                                                                                                                        \
     STREAMABLE_RESET_ACCESS_MODIFIER
 
+// the fields of the class and of its bases in the order they are written, a template so it's made only when used by
+// ::hbann::Columnar, the bases may not define it
+#define STREAMABLE_DEFINE_COLUMNS(className, ...)                                                                      \
+  protected:                                                                                                           \
+    template <typename TypeSelf = className> [[nodiscard]] auto StreamableColumns() noexcept                           \
+    {                                                                                                                  \
+        return std::tuple_cat(TypeSelf::StreamableColumnsBases(), ::hbann::detail::tie_fields(__VA_ARGS__));           \
+    }                                                                                                                  \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
+
 #define STREAMABLE_DEFINE_INTRUSIVE                                                                                    \
   private:                                                                                                             \
     friend class ::hbann::StreamReader;                                                                                \
-    friend class ::hbann::StreamWriter;
+    friend class ::hbann::StreamWriter;                                                                                \
+    friend class ::hbann::Reflector;
+
+#define STREAMABLE_DEFINE_DERIVED(...)                                                                                 \
+  public:                                                                                                              \
+    using StreamableDerived = std::tuple<__VA_ARGS__>;                                                                 \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
 
 #define STREAMABLE_DEFINE(className, ...)                                                                              \
     STREAMABLE_DEFINE_INTRUSIVE                                                                                        \
                                                                                                                        \
     STREAMABLE_DEFINE_TO_STREAM(className, __VA_ARGS__)                                                                \
     STREAMABLE_DEFINE_FROM_STREAM(className, __VA_ARGS__)                                                              \
+    STREAMABLE_DEFINE_COLUMNS(className, __VA_ARGS__)                                                                  \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
+
+#define STREAMABLE_DEFINE_TAGGED_IDS(...)                                                                              \
+    static constexpr auto streamableIds =                                                                              \
+        ::hbann::Tag::FindIds<std::tuple_size_v<decltype(std::tie(__VA_ARGS__))>>(#__VA_ARGS__);
+
+// like STREAMABLE_DEFINE, but the fields are written with their ids so they can be reordered, removed and added
+#define STREAMABLE_DEFINE_TAGGED(className, ...)                                                                       \
+    STREAMABLE_DEFINE_INTRUSIVE                                                                                        \
+                                                                                                                       \
+  protected:                                                                                                           \
+    void ToStream() override                                                                                           \
+    {                                                                                                                  \
+        className::ToStreamBases();                                                                                    \
+                                                                                                                       \
+        STREAMABLE_DEFINE_TAGGED_IDS(__VA_ARGS__)                                                                      \
+        mStreamWriter.WriteTagged(streamableIds, __VA_ARGS__);                                                         \
+    }                                                                                                                  \
+                                                                                                                       \
+    void FromStream() override                                                                                         \
+    {                                                                                                                  \
+        className::FromStreamBases();                                                                                  \
+                                                                                                                       \
+        STREAMABLE_DEFINE_TAGGED_IDS(__VA_ARGS__)                                                                      \
+        mStreamReader.ReadTagged(streamableIds, __VA_ARGS__);                                                          \
+    }                                                                                                                  \
+                                                                                                                       \
+    STREAMABLE_DEFINE_COLUMNS(className, __VA_ARGS__)                                                                  \
+                                                                                                                       \
+    STREAMABLE_RESET_ACCESS_MODIFIER
+
+// like STREAMABLE_DEFINE, but the optionals are written as a bitmap of their presence followed by their values
+#define STREAMABLE_DEFINE_SPARSE(className, ...)                                                                       \
+    STREAMABLE_DEFINE_INTRUSIVE                                                                                        \
+                                                                                                                       \
+  protected:                                                                                                           \
+    void ToStream() override                                                                                           \
+    {                                                                                                                  \
+        className::ToStreamBases();                                                                                    \
+                                                                                                                       \
+        mStreamWriter.WriteSparse(__VA_ARGS__);                                                                        \
+    }                                                                                                                  \
+                                                                                                                       \
+    void FromStream() override                                                                                         \
+    {                                                                                                                  \
+        className::FromStreamBases();                                                                                  \
+                                                                                                                       \
+        mStreamReader.ReadSparse(__VA_ARGS__);                                                                         \
+    }                                                                                                                  \
+                                                                                                                       \
+    STREAMABLE_DEFINE_COLUMNS(className, __VA_ARGS__)                                                                  \
                                                                                                                        \
     STREAMABLE_RESET_ACCESS_MODIFIER
 
+// used outside of the class, in its namespace, the public fields are written one after another without any state
+#define STREAMABLE_DEFINE_FIELDS(className, ...)                                                                       \
+    template <typename Type>                                                                                           \
+        requires std::same_as<std::remove_const_t<Type>, className>                                                    \
+    [[nodiscard]] constexpr auto StreamableFields(Type &aObject) noexcept                                              \
+    {                                                                                                                  \
+        return std::tuple_cat(SF_FIELDS(__VA_ARGS__) std::tuple<>{});                                                  \
+    }
+
 namespace hbann
 {
+// the rank is a size_t, that is not declared yet in the forward declarations
+template <typename, size_t> class Dense;
+
 namespace detail
 {
 template <typename> struct is_pair : std::false_type
@@ -193,7 +295,8 @@ template <typename... Types> struct is_variant<std::variant<Types...>> : std::tr
 template <typename> struct is_unique_ptr : std::false_type
 {
 };
-template <typename Type> struct is_unique_ptr<std::unique_ptr<Type>> : std::true_type
+template <typename Type, typename TypeDeleter>
+struct is_unique_ptr<std::unique_ptr<Type, TypeDeleter>> : std::true_type
 {
 };
 
@@ -217,8 +320,107 @@ template <typename> struct is_basic_string : std::false_type
 template <typename... Types> struct is_basic_string<std::basic_string<Types...>> : std::true_type
 {
 };
+
+template <typename Container> struct range_value
+{
+    using type = std::ranges::range_value_t<Container>;
+};
+// containers name their element (a path iterates over paths, but it's made of characters) and views don't
+template <typename Container>
+    requires requires { typename Container::value_type; }
+struct range_value<Container>
+{
+    using type = typename Container::value_type;
+};
+
+template <typename> struct is_std_array : std::false_type
+{
+};
+template <typename Type, size_t vSize> struct is_std_array<std::array<Type, vSize>> : std::true_type
+{
+};
+
+template <typename> struct is_span : std::false_type
+{
+};
+template <typename Type, size_t vExtent> struct is_span<std::span<Type, vExtent>> : std::true_type
+{
+};
+
+template <typename> struct is_dense : std::false_type
+{
+};
+template <typename Type, size_t vRank> struct is_dense<Dense<Type, vRank>> : std::true_type
+{
+};
+
+template <typename> struct is_rectangular : std::false_type
+{
+};
+template <typename Type> struct is_rectangular<Rectangular<Type>> : std::true_type
+{
+};
+
+template <typename> struct is_columnar : std::false_type
+{
+};
+template <typename Type> struct is_columnar<Columnar<Type>> : std::true_type
+{
+};
+
+// delays the lookup in Type until TypeDependent is known
+template <typename Type, typename TypeDependent> struct dependent
+{
+    using type = Type;
+};
+
+template <typename Type, typename TypeDependent> using dependent_t = typename dependent<Type, TypeDependent>::type;
+
+// like std::tie, but the temporaries passed to the macros (ex.: hbann::Rectangular) are kept by value
+template <typename... Types> [[nodiscard]] constexpr auto tie_fields(Types &&...aObjects) noexcept
+{
+    return std::tuple<Types...>(std::forward<Types>(aObjects)...);
+}
+
+// converts to any field of an aggregate, so we can count them by how many of it initialize the aggregate
+template <typename TypeAggregate> struct any_field
+{
+    template <typename Type>
+        requires(!std::is_same_v<Type, TypeAggregate>)
+    operator Type() const noexcept;
+};
+
+template <typename Type, typename... Fields> [[nodiscard]] consteval size_t find_field_count() noexcept
+{
+    if constexpr (requires { Type{Fields{}..., any_field<Type>{}}; })
+    {
+        return find_field_count<Type, Fields..., any_field<Type>>();
+    }
+    else
+    {
+        return sizeof...(Fields);
+    }
+}
+
+// like find_field_count, but the fields are initialized from braces so the elements of arrays are not counted
+template <typename Type, typename... Fields> [[nodiscard]] consteval size_t find_field_count_braced() noexcept
+{
+    if constexpr (requires { Type{{Fields{}}..., {any_field<Type>{}}}; })
+    {
+        return find_field_count_braced<Type, Fields..., any_field<Type>>();
+    }
+    else
+    {
+        return sizeof...(Fields);
+    }
+}
 } // namespace detail
 
+template <typename Type> inline constexpr bool is_std_array_v = detail::is_std_array<Type>::value;
+template <typename Type> inline constexpr bool is_span_v = detail::is_span<Type>::value;
+template <typename Type> inline constexpr bool is_dense_v = detail::is_dense<Type>::value;
+template <typename Type> inline constexpr bool is_rectangular_v = detail::is_rectangular<Type>::value;
+template <typename Type> inline constexpr bool is_columnar_v = detail::is_columnar<Type>::value;
 template <typename Type> inline constexpr bool is_pair_v = detail::is_pair<Type>::value;
 template <typename Type> inline constexpr bool is_tuple_v = detail::is_tuple<Type>::value;
 template <typename Type> inline constexpr bool is_variant_v = detail::is_variant<Type>::value;
@@ -227,6 +429,8 @@ template <typename Type> inline constexpr bool is_unique_ptr_v = detail::is_uniq
 template <typename Type> inline constexpr bool is_shared_ptr_v = detail::is_shared_ptr<Type>::value;
 template <typename Type> inline constexpr bool is_basic_string_v = detail::is_basic_string<Type>::value;
 
+template <typename Container> using range_value_t = typename detail::range_value<Container>::type;
+
 template <typename> inline constexpr auto always_false = false;
 
 template <typename Type>
@@ -238,6 +442,16 @@ concept is_u16string = std::is_same_v<typename Type::value_type, std::u16string:
 template <typename Type>
 concept is_utf16string = is_u16string<Type> || (sizeof(std::wstring::value_type) == 2 && is_wstring<Type>);
 
+template <typename Type>
+concept is_u32string = std::is_same_v<typename Type::value_type, std::u32string::value_type> && is_basic_string_v<Type>;
+
+template <typename Type>
+concept is_utf32string = is_u32string<Type> || (sizeof(std::wstring::value_type) == 4 && is_wstring<Type>);
+
+// the strings written in UTF-8, their count is in bytes
+template <typename Type>
+concept is_wide_string = is_utf16string<Type> || is_utf32string<Type>;
+
 template <typename Type>
 concept is_smart_pointer = is_shared_ptr_v<Type> || is_unique_ptr_v<Type>;
 
@@ -256,39 +470,103 @@ template <typename... Types>
 concept are_same_as_istreamable = (std::is_same_v<Types, IStreamable> || ...);
 
 template <typename Type>
-concept is_standard_layout_no_pointer = std::is_standard_layout_v<Type> && !is_any_pointer<Type>;
+concept has_streamable_derived = is_tuple_v<typename Type::StreamableDerived>;
+
+// the customization point of classes that don't inherit a streamable, it returns a tuple of references to the fields
+template <typename Type>
+concept has_streamable_fields =
+    requires(Type &aObject) { requires is_tuple_v<decltype(StreamableFields(aObject))>; };
+
+// the most fields Reflector can bind
+inline constexpr size_t REFLECTABLE_FIELDS_MAX = 64;
+
+// the most an aligned stream aligns its objects to, the nested streams start at it
+inline constexpr size_t ALIGNMENT_MAX = alignof(std::max_align_t);
+
+// aggregates that can't be copied as bytes are written field by field, without listing them in a macro
+template <typename Type>
+concept is_reflectable = std::is_aggregate_v<Type> && !std::is_array_v<Type> && !std::is_trivially_copyable_v<Type> &&
+                         !std::ranges::range<Type> && !has_streamable_fields<Type> &&
+                         detail::find_field_count<Type>() > 0 &&
+                         detail::find_field_count<Type>() <= REFLECTABLE_FIELDS_MAX;
+
+// written as their shape followed by their elements
+template <typename Type>
+concept is_shaped = is_dense_v<Type> || is_rectangular_v<Type>;
+
+// spans, shaped arrays and columns are standard layout, but they point to their elements
+// aggregates whose fields can be bound, the counts differ for arrays and for fields ambiguous to initialize from braces
+template <typename Type>
+concept is_bindable = std::is_aggregate_v<Type> && !std::is_array_v<Type> && detail::find_field_count<Type>() > 0 &&
+                      detail::find_field_count<Type>() == detail::find_field_count_braced<Type>();
+
+template <typename Type>
+concept is_standard_layout_no_pointer = std::is_standard_layout_v<Type> && !is_any_pointer<Type> && !is_span_v<Type> &&
+                                        !is_shaped<Type> && !is_columnar_v<Type> && !has_streamable_fields<Type> &&
+                                        !is_reflectable<Type>;
+
+// arrays know their count, so they are written without one
+template <typename Type>
+concept is_fixed_array = std::is_bounded_array_v<Type> || is_std_array_v<Type>;
+
+template <typename Type>
+concept is_fixed_extent = is_fixed_array<Type> || (is_span_v<Type> && Type::extent != std::dynamic_extent);
 
 template <typename Type>
 concept is_path = std::is_same_v<Type, std::filesystem::path>;
 
+template <typename Type> [[nodiscard]] consteval bool find_known_size() noexcept
+{
+    if constexpr (is_fixed_array<Type>)
+    {
+        return find_known_size<std::ranges::range_value_t<Type>>();
+    }
+    else
+    {
+        return is_standard_layout_no_pointer<Type> && !is_optional_v<Type> && !is_variant_v<Type> &&
+               !is_tuple_v<Type> && !is_pair_v<Type> && !std::ranges::range<Type> &&
+               !std::derived_from<Type, IStreamable>;
+    }
+}
+
+// the objects written as their bytes, it mirrors the branches of the writer and the reader
+template <typename Type>
+concept is_known_size = find_known_size<Type>();
+
 template <typename Container>
 concept is_range_standard_layout =
-    (std::ranges::contiguous_range<Container> && is_standard_layout_no_pointer<typename Container::value_type>) ||
+    (std::ranges::contiguous_range<Container> && std::ranges::sized_range<Container> &&
+     is_standard_layout_no_pointer<range_value_t<Container>>) ||
     is_path<Container>;
 
 template <typename Container>
 concept has_method_size = requires(Container &aContainer) { std::ranges::size(aContainer); };
 
+template <typename Container>
+concept has_method_reserve = requires(Container &aContainer) { aContainer.reserve(std::size_t{}); };
+
+template <typename Container>
+concept has_method_resize = requires(Container &aContainer) { aContainer.resize(std::size_t{}); };
+
+// their order depends on the hashes and the history of the container
+template <typename Container>
+concept is_unordered = std::ranges::range<Container> && requires { typename Container::hasher; };
+
+// the elements that changed are written one by one in a delta, the strings are written whole
+template <typename Container>
+concept is_patchable = std::ranges::random_access_range<Container> && std::ranges::sized_range<Container> &&
+                       has_method_resize<Container> && !is_basic_string_v<Container>;
+
+template <typename Container>
+concept has_method_emplace_hint = requires(Container &aContainer, typename Container::value_type &&aObject) {
+    aContainer.emplace_hint(std::ranges::cend(aContainer), std::move(aObject));
+};
+
 [[nodiscard]] consteval bool static_equal(const auto &aString1, const auto &aString2) noexcept
 {
     return *aString1 == *aString2 && (!*aString1 || static_equal(aString1 + 1, aString2 + 1));
 }
 
-template <typename Type, std::size_t vIndex = 0>
-[[nodiscard]] constexpr Type variant_from_index(const std::size_t aIndex)
-{
-    static_assert(is_variant_v<Type>, "Type is not a variant!");
-
-    if constexpr (vIndex < std::variant_size_v<Type>)
-    {
-        return aIndex ? variant_from_index<Type, vIndex + 1>(aIndex - 1) : Type{std::in_place_index<vIndex>};
-    }
-    else
-    {
-        throw std::out_of_range("Out of bounds variant index!");
-    }
-}
-
 template <typename Type> [[nodiscard]] static constexpr Type ByteSwap(const Type aSize) noexcept
 {
     static_assert(always_false<Type>, "ByteSwap is not implemented for this type!");
@@ -309,734 +587,4001 @@ template <> [[nodiscard]] constexpr uint64_t ByteSwap(const uint64_t aSize) noex
            ((aSize & 0x000000000000FF00) << 40) | ((aSize & 0x00000000000000FF) << 56);
 }
 
+/*
+    Transcodes the UTF-16 and UTF-32 strings (ex.: std::wstring) to UTF-8 and back, on every platform
+
+    The runs of ASCII characters are copied 16 at a time with SSE2 or NEON, the other characters one by one. The code
+    units that are not valid (ex.: unpaired surrogates) become U+FFFD, like the bytes that are not valid UTF-8.
+*/
 class Converter
 {
   public:
-    template <typename Type> [[nodiscard]] static constexpr auto Encode(const Type &aString)
+    static constexpr char32_t REPLACEMENT = 0xFFFD;
+
+    template <typename Type> [[nodiscard]] static constexpr std::string Encode(const Type &aString)
     {
-        static_assert(is_utf16string<Type>, "Type must be a UTF16 string!");
+        static_assert(is_wide_string<Type>, "Type must be a UTF16 or UTF32 string!");
 
-#ifdef _WIN32
-        const auto requiredSize = WideCharToMultiByte(CP_UTF8, 0, reinterpret_cast<LPCWCH>(aString.data()),
-                                                      static_cast<int>(aString.size()), nullptr, 0, nullptr, nullptr);
-        std::string str(requiredSize, 0);
+        // a UTF-16 code unit is at most 3 bytes (a surrogate pair is 4 bytes) and a UTF-32 one at most 4 bytes
+        std::string bytes(aString.size() * (is_utf16string<Type> ? 3 : 4), 0);
+        const auto units = aString.data();
+        const auto count = aString.size();
 
-        WideCharToMultiByte(CP_UTF8, 0, reinterpret_cast<LPCWCH>(aString.data()), static_cast<int>(aString.size()),
-                            str.data(), requiredSize, nullptr, nullptr);
-        return str;
-#else
-        return std::string_view{reinterpret_cast<const std::string::value_type *>(aString.data()),
-                                aString.size() * sizeof(typename Type::value_type)};
-#endif
+        size_t size{};
+        for (size_t i = 0; i < count;)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const auto countAscii = EncodeAscii(units + i, count - i, bytes.data() + size);
+                i += countAscii;
+                size += countAscii;
+
+                if (i == count)
+                {
+                    break;
+                }
+            }
+
+            auto codePoint = static_cast<char32_t>(FindUnit(units[i++]));
+            if constexpr (is_utf16string<Type>)
+            {
+                if (IsSurrogateHigh(codePoint) && i < count && IsSurrogateLow(FindUnit(units[i])))
+                {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (FindUnit(units[i++]) - 0xDC00);
+                }
+            }
+
+            size += EncodeCodePoint(codePoint, bytes.data() + size);
+        }
+
+        bytes.resize(size);
+        return bytes;
     }
 
-    template <typename Type> [[nodiscard]] static constexpr auto Decode(const std::span<const uint8_t> aString)
+    template <typename Type> [[nodiscard]] static constexpr Type Decode(const std::span<const uint8_t> aBytes)
     {
-        static_assert(is_utf16string<Type>, "Type must be a UTF16 string!");
+        static_assert(is_wide_string<Type>, "Type must be a UTF16 or UTF32 string!");
 
-#ifdef _WIN32
-        const auto requiredSize = MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<LPCCH>(aString.data()),
-                                                      static_cast<int>(aString.size()), nullptr, 0);
-        Type str(requiredSize, 0);
+        // a byte is at most a code unit
+        Type string(aBytes.size(), 0);
+        const auto bytes = aBytes.data();
+        const auto count = aBytes.size();
 
-        MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<LPCCH>(aString.data()), static_cast<int>(aString.size()),
-                            str.data(), requiredSize);
-        return str;
-#else
-        using TypeValueType = typename Type::value_type;
-        return std::basic_string_view<TypeValueType>{reinterpret_cast<const TypeValueType *>(aString.data()),
-                                                     aString.size() / sizeof(TypeValueType)};
-#endif
+        size_t size{};
+        for (size_t i = 0; i < count;)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const auto countAscii = DecodeAscii(bytes + i, count - i, string.data() + size);
+                i += countAscii;
+                size += countAscii;
+
+                if (i == count)
+                {
+                    break;
+                }
+            }
+
+            const auto codePoint = DecodeCodePoint(aBytes, i);
+            if constexpr (is_utf16string<Type>)
+            {
+                if (codePoint >= 0x10000)
+                {
+                    string[size++] = static_cast<typename Type::value_type>(0xD800 + ((codePoint - 0x10000) >> 10));
+                    string[size++] = static_cast<typename Type::value_type>(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+                    continue;
+                }
+            }
+
+            string[size++] = static_cast<typename Type::value_type>(codePoint);
+        }
+
+        string.resize(size);
+        return string;
     }
-};
 
-/*
-    Format: first 3 bits + the actual size at last
+  private:
+    // the value of a code unit, wchar_t may be signed
+    template <typename TypeUnit> [[nodiscard]] static constexpr uint32_t FindUnit(const TypeUnit aUnit) noexcept
+    {
+        return static_cast<std::make_unsigned_t<TypeUnit>>(aUnit);
+    }
 
-    The first 3 bits represent how many bytes are necessary to represent the actual size with those 3 bits and they are
-   written at the most left side of the 1-8 bytes.
+    [[nodiscard]] static constexpr bool IsSurrogateHigh(const char32_t aUnit) noexcept
+    {
+        return aUnit >= 0xD800 && aUnit <= 0xDBFF;
+    }
 
-    The actual size is written to the left most side of the 1-8 bytes.
-*/
-class Size
-{
-  public:
-    using size_max = size_t; // size_t / (4/8)
-    using span = std::span<const uint8_t>;
+    [[nodiscard]] static constexpr bool IsSurrogateLow(const char32_t aUnit) noexcept
+    {
+        return aUnit >= 0xDC00 && aUnit <= 0xDFFF;
+    }
 
-    [[nodiscard]] static constexpr auto FindRequiredBytes(const uint8_t aSize) noexcept
+    [[nodiscard]] static constexpr size_t EncodeCodePoint(char32_t aCodePoint, char *aBytes) noexcept
     {
-        if constexpr (SIZE_MAX_IN_BYTES == 4)
-        {
-            return static_cast<size_max>(aSize >> 6);
-        }
-        else
+        if ((aCodePoint >= 0xD800 && aCodePoint <= 0xDFFF) || aCodePoint > 0x10FFFF)
         {
-            return static_cast<size_max>(aSize >> 5);
+            aCodePoint = REPLACEMENT;
         }
-    }
 
-    [[nodiscard]] static constexpr size_max FindRequiredBytes(const size_max aSize) noexcept
-    {
-        size_max requiredBits{1};
-        if (aSize)
+        if (aCodePoint < 0x80)
         {
-            // add the bits required to represent the size
-            requiredBits += static_cast<size_max>(std::log2(aSize));
+            aBytes[0] = static_cast<char>(aCodePoint);
+            return 1;
         }
 
-        // add the bits required to represent the required bytes to store the final value
-        if constexpr (SIZE_MAX_IN_BYTES == 4)
+        if (aCodePoint < 0x800)
         {
-            requiredBits += 2;
+            aBytes[0] = static_cast<char>(0xC0 | aCodePoint >> 6);
+            aBytes[1] = static_cast<char>(0x80 | (aCodePoint & 0x3F));
+            return 2;
         }
-        else
+
+        if (aCodePoint < 0x10000)
         {
-            requiredBits += 3;
+            aBytes[0] = static_cast<char>(0xE0 | aCodePoint >> 12);
+            aBytes[1] = static_cast<char>(0x80 | (aCodePoint >> 6 & 0x3F));
+            aBytes[2] = static_cast<char>(0x80 | (aCodePoint & 0x3F));
+            return 3;
         }
 
-        // add 7 bits to round the final value up
-        return (requiredBits + 7) / 8;
+        aBytes[0] = static_cast<char>(0xF0 | aCodePoint >> 18);
+        aBytes[1] = static_cast<char>(0x80 | (aCodePoint >> 12 & 0x3F));
+        aBytes[2] = static_cast<char>(0x80 | (aCodePoint >> 6 & 0x3F));
+        aBytes[3] = static_cast<char>(0x80 | (aCodePoint & 0x3F));
+        return 4;
     }
 
-    [[nodiscard]] static inline auto MakeSize(const size_max aSize) noexcept
+    // decodes the code point at aIndex and moves after it, a sequence that is not valid is replaced up to the first
+    // byte that can't continue it (overlong forms, surrogates and code points after U+10FFFF are not valid)
+    [[nodiscard]] static constexpr char32_t DecodeCodePoint(const std::span<const uint8_t> aBytes, size_t &aIndex)
     {
-        thread_local uint8_t SIZE_AS_CHARS[SIZE_MAX_IN_BYTES]{};
-        auto &SIZE = *reinterpret_cast<size_max *>(SIZE_AS_CHARS);
-
-        const auto requiredBytes = FindRequiredBytes(aSize);
-        auto SIZE_AS_CHARS_START = SIZE_AS_CHARS + (SIZE_MAX_IN_BYTES - requiredBytes);
+        const auto lead = aBytes[aIndex++];
+        if (lead < 0x80)
+        {
+            return lead;
+        }
 
-        // write the size itself
-        SIZE = ToBigEndian(aSize);
-        // write the 3 bits representing the bytes required
-        if constexpr (SIZE_MAX_IN_BYTES == 4)
+        size_t count{};
+        char32_t codePoint{};
+        uint8_t lower = 0x80, upper = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF)
+        {
+            count = 1;
+            codePoint = lead & 0x1F;
+        }
+        else if (lead >= 0xE0 && lead <= 0xEF)
+        {
+            count = 2;
+            codePoint = lead & 0x0F;
+            lower = lead == 0xE0 ? 0xA0 : lower;
+            upper = lead == 0xED ? 0x9F : upper;
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4)
         {
-            *SIZE_AS_CHARS_START |= requiredBytes << 6;
+            count = 3;
+            codePoint = lead & 0x07;
+            lower = lead == 0xF0 ? 0x90 : lower;
+            upper = lead == 0xF4 ? 0x8F : upper;
         }
         else
         {
-            *SIZE_AS_CHARS_START |= requiredBytes << 5;
+            return REPLACEMENT;
         }
 
-        // return the last 'requiredBytes' from SIZE
-        return span{SIZE_AS_CHARS_START, requiredBytes};
-    }
+        // the bounds of the second byte rule out the overlong forms, the surrogates and the code points too big
+        for (size_t i = 0; i < count; i++, lower = 0x80, upper = 0xBF)
+        {
+            if (aIndex == aBytes.size() || aBytes[aIndex] < lower || aBytes[aIndex] > upper)
+            {
+                return REPLACEMENT;
+            }
+
+            codePoint = codePoint << 6 | (aBytes[aIndex++] & 0x3F);
+        }
+
+        return codePoint;
+    }
+
+    // copies the ASCII characters from the start of aUnits, returns their count
+    template <typename TypeUnit>
+    [[nodiscard]] static size_t EncodeAscii(const TypeUnit *aUnits, const size_t aCount, char *aBytes) noexcept
+    {
+        size_t i{};
+
+#if defined(STREAMABLE_SSE2)
+        for (; i + 16 <= aCount; i += 16)
+        {
+            const auto units = reinterpret_cast<const __m128i *>(aUnits + i);
+            __m128i bytes{};
+            if constexpr (sizeof(TypeUnit) == sizeof(char16_t))
+            {
+                const auto units1 = _mm_loadu_si128(units);
+                const auto units2 = _mm_loadu_si128(units + 1);
+                const auto unitsHigh = _mm_and_si128(_mm_or_si128(units1, units2), _mm_set1_epi16(~0x7F));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(unitsHigh, _mm_setzero_si128())) != 0xFFFF)
+                {
+                    break;
+                }
+
+                bytes = _mm_packus_epi16(units1, units2);
+            }
+            else
+            {
+                const auto units1 = _mm_loadu_si128(units);
+                const auto units2 = _mm_loadu_si128(units + 1);
+                const auto units3 = _mm_loadu_si128(units + 2);
+                const auto units4 = _mm_loadu_si128(units + 3);
+                const auto unitsOr = _mm_or_si128(_mm_or_si128(units1, units2), _mm_or_si128(units3, units4));
+                const auto unitsHigh = _mm_and_si128(unitsOr, _mm_set1_epi32(~0x7F));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(unitsHigh, _mm_setzero_si128())) != 0xFFFF)
+                {
+                    break;
+                }
+
+                bytes = _mm_packus_epi16(_mm_packs_epi32(units1, units2), _mm_packs_epi32(units3, units4));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(aBytes + i), bytes);
+        }
+#elif defined(STREAMABLE_NEON)
+        for (; i + 16 <= aCount; i += 16)
+        {
+            uint8x16_t bytes{};
+            if constexpr (sizeof(TypeUnit) == sizeof(char16_t))
+            {
+                const auto units = reinterpret_cast<const uint16_t *>(aUnits + i);
+                const auto units1 = vld1q_u16(units);
+                const auto units2 = vld1q_u16(units + 8);
+                if (vmaxvq_u16(vorrq_u16(units1, units2)) >= 0x80)
+                {
+                    break;
+                }
+
+                bytes = vcombine_u8(vmovn_u16(units1), vmovn_u16(units2));
+            }
+            else
+            {
+                const auto units = reinterpret_cast<const uint32_t *>(aUnits + i);
+                const auto units1 = vld1q_u32(units);
+                const auto units2 = vld1q_u32(units + 4);
+                const auto units3 = vld1q_u32(units + 8);
+                const auto units4 = vld1q_u32(units + 12);
+                if (vmaxvq_u32(vorrq_u32(vorrq_u32(units1, units2), vorrq_u32(units3, units4))) >= 0x80)
+                {
+                    break;
+                }
+
+                bytes = vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(units1), vmovn_u32(units2))),
+                                    vmovn_u16(vcombine_u16(vmovn_u32(units3), vmovn_u32(units4))));
+            }
+
+            vst1q_u8(reinterpret_cast<uint8_t *>(aBytes + i), bytes);
+        }
+#endif
+
+        for (; i < aCount && FindUnit(aUnits[i]) < 0x80; i++)
+        {
+            aBytes[i] = static_cast<char>(aUnits[i]);
+        }
+
+        return i;
+    }
+
+    // copies the ASCII characters from the start of aBytes, returns their count
+    template <typename TypeUnit>
+    [[nodiscard]] static size_t DecodeAscii(const uint8_t *aBytes, const size_t aCount, TypeUnit *aUnits) noexcept
+    {
+        size_t i{};
+
+#if defined(STREAMABLE_SSE2)
+        for (; i + 16 <= aCount; i += 16)
+        {
+            const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBytes + i));
+            if (_mm_movemask_epi8(bytes))
+            {
+                break;
+            }
+
+            const auto units = reinterpret_cast<__m128i *>(aUnits + i);
+            const auto zero = _mm_setzero_si128();
+            const auto units1 = _mm_unpacklo_epi8(bytes, zero);
+            const auto units2 = _mm_unpackhi_epi8(bytes, zero);
+            if constexpr (sizeof(TypeUnit) == sizeof(char16_t))
+            {
+                _mm_storeu_si128(units, units1);
+                _mm_storeu_si128(units + 1, units2);
+            }
+            else
+            {
+                _mm_storeu_si128(units, _mm_unpacklo_epi16(units1, zero));
+                _mm_storeu_si128(units + 1, _mm_unpackhi_epi16(units1, zero));
+                _mm_storeu_si128(units + 2, _mm_unpacklo_epi16(units2, zero));
+                _mm_storeu_si128(units + 3, _mm_unpackhi_epi16(units2, zero));
+            }
+        }
+#elif defined(STREAMABLE_NEON)
+        for (; i + 16 <= aCount; i += 16)
+        {
+            const auto bytes = vld1q_u8(aBytes + i);
+            if (vmaxvq_u8(bytes) >= 0x80)
+            {
+                break;
+            }
+
+            const auto units1 = vmovl_u8(vget_low_u8(bytes));
+            const auto units2 = vmovl_u8(vget_high_u8(bytes));
+            if constexpr (sizeof(TypeUnit) == sizeof(char16_t))
+            {
+                const auto units = reinterpret_cast<uint16_t *>(aUnits + i);
+                vst1q_u16(units, units1);
+                vst1q_u16(units + 8, units2);
+            }
+            else
+            {
+                const auto units = reinterpret_cast<uint32_t *>(aUnits + i);
+                vst1q_u32(units, vmovl_u16(vget_low_u16(units1)));
+                vst1q_u32(units + 4, vmovl_u16(vget_high_u16(units1)));
+                vst1q_u32(units + 8, vmovl_u16(vget_low_u16(units2)));
+                vst1q_u32(units + 12, vmovl_u16(vget_high_u16(units2)));
+            }
+        }
+#endif
+
+        for (; i < aCount && aBytes[i] < 0x80; i++)
+        {
+            aUnits[i] = static_cast<TypeUnit>(aBytes[i]);
+        }
+
+        return i;
+    }
+};
+
+/*
+    Format: first 3 bits + the actual size at last
+
+    The first 3 bits represent how many bytes are necessary to represent the actual size with those 3 bits and they are
+   written at the most left side of the 1-8 bytes.
+
+    The actual size is written to the left most side of the 1-8 bytes.
+*/
+class Size
+{
+  public:
+    using size_max = size_t; // size_t / (4/8)
+    using span = std::span<const uint8_t>;
+
+    [[nodiscard]] static constexpr auto FindRequiredBytes(const uint8_t aSize) noexcept
+    {
+        if constexpr (SIZE_MAX_IN_BYTES == 4)
+        {
+            return static_cast<size_max>(aSize >> 6);
+        }
+        else
+        {
+            return static_cast<size_max>(aSize >> 5);
+        }
+    }
+
+    [[nodiscard]] static constexpr size_max FindRequiredBytes(const size_max aSize) noexcept
+    {
+        size_max requiredBits{1};
+        if (aSize)
+        {
+            // add the bits required to represent the size
+            requiredBits += static_cast<size_max>(std::bit_width(aSize)) - 1;
+        }
+
+        // add the bits required to represent the required bytes to store the final value
+        if constexpr (SIZE_MAX_IN_BYTES == 4)
+        {
+            requiredBits += 2;
+        }
+        else
+        {
+            requiredBits += 3;
+        }
+
+        // add 7 bits to round the final value up
+        return (requiredBits + 7) / 8;
+    }
+
+    [[nodiscard]] static constexpr auto MakeSize(const size_max aSize) noexcept
+    {
+        const auto requiredBytes = FindRequiredBytes(aSize);
+
+        Bytes size{};
+        size.mCount = requiredBytes;
+
+        // write the size itself in big endian
+        for (size_max i = 0; i < requiredBytes; i++)
+        {
+            size.mBytes[i] = static_cast<uint8_t>(aSize >> ((requiredBytes - 1 - i) * 8));
+        }
+
+        // write the 3 bits representing the bytes required
+        if constexpr (SIZE_MAX_IN_BYTES == 4)
+        {
+            size.mBytes.front() |= requiredBytes << 6;
+        }
+        else
+        {
+            size.mBytes.front() |= requiredBytes << 5;
+        }
+
+        return size;
+    }
+
+    [[nodiscard]] static constexpr size_max MakeSize(const span aSize) noexcept
+    {
+        const auto requiredBytes = FindRequiredBytes(aSize.front());
+
+        // clear the required bytes
+        size_max size{};
+        if constexpr (SIZE_MAX_IN_BYTES == 4)
+        {
+            size = aSize.front() & 0b00111111;
+        }
+        else
+        {
+            size = aSize.front() & 0b00011111;
+        }
+
+        // read the rest of the size in big endian
+        for (size_max i = 1; i < requiredBytes; i++)
+        {
+            size = (size << 8) | aSize[i];
+        }
+
+        return size;
+    }
+
+    // the bytes of a size are kept by value so it can be made at compile time too
+    class Bytes
+    {
+        friend class Size;
+
+      public:
+        [[nodiscard]] constexpr operator span() const noexcept
+        {
+            return {mBytes.data(), mCount};
+        }
+
+      private:
+        std::array<uint8_t, sizeof(size_max)> mBytes{};
+        size_max mCount{};
+    };
+
+  private:
+    static inline constexpr auto SIZE_MAX_IN_BYTES = sizeof(size_max);
+};
+
+/*
+    Binds the fields of an aggregate with structured bindings, so it can be (de)serialized without a macro
+
+    The aggregate must not have bases or C arrays as fields, they can't be counted right.
+*/
+class Reflector
+{
+  public:
+    // the fields of a record (streamable, class with fields or aggregate) in the order they are written
+    template <typename TypeRecord> [[nodiscard]] static constexpr auto TieFields(TypeRecord &aRecord)
+    {
+        if constexpr (std::derived_from<TypeRecord, IStreamable>)
+        {
+            return aRecord.StreamableColumns();
+        }
+        else if constexpr (has_streamable_fields<TypeRecord>)
+        {
+            return StreamableFields(aRecord);
+        }
+        else if constexpr (is_reflectable<TypeRecord>)
+        {
+            return Tie(aRecord);
+        }
+        else
+        {
+            static_assert(always_false<TypeRecord>, "The records must be streamables, have fields or be aggregates!");
+        }
+    }
+
+    template <typename Type> [[nodiscard]] static consteval size_t FindFieldCount() noexcept
+    {
+        return detail::find_field_count<std::remove_cv_t<Type>>();
+    }
+
+    // a tuple of references to the fields of the aggregate
+    template <typename Type> [[nodiscard]] static constexpr auto Tie(Type &aObject) noexcept
+    {
+        constexpr auto count = FindFieldCount<Type>();
+        static_assert(count && count <= REFLECTABLE_FIELDS_MAX, "Type has no fields or too many to be reflected!");
+
+        if constexpr (count == 1)
+        {
+            auto &[o1] = aObject;
+            return std::tie(o1);
+        }
+        else if constexpr (count == 2)
+        {
+            auto &[o1, o2] = aObject;
+            return std::tie(o1, o2);
+        }
+        else if constexpr (count == 3)
+        {
+            auto &[o1, o2, o3] = aObject;
+            return std::tie(o1, o2, o3);
+        }
+        else if constexpr (count == 4)
+        {
+            auto &[o1, o2, o3, o4] = aObject;
+            return std::tie(o1, o2, o3, o4);
+        }
+        else if constexpr (count == 5)
+        {
+            auto &[o1, o2, o3, o4, o5] = aObject;
+            return std::tie(o1, o2, o3, o4, o5);
+        }
+        else if constexpr (count == 6)
+        {
+            auto &[o1, o2, o3, o4, o5, o6] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6);
+        }
+        else if constexpr (count == 7)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7);
+        }
+        else if constexpr (count == 8)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8);
+        }
+        else if constexpr (count == 9)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9);
+        }
+        else if constexpr (count == 10)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10);
+        }
+        else if constexpr (count == 11)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11);
+        }
+        else if constexpr (count == 12)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12);
+        }
+        else if constexpr (count == 13)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13);
+        }
+        else if constexpr (count == 14)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14);
+        }
+        else if constexpr (count == 15)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15);
+        }
+        else if constexpr (count == 16)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16);
+        }
+        else if constexpr (count == 17)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17);
+        }
+        else if constexpr (count == 18)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18);
+        }
+        else if constexpr (count == 19)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19);
+        }
+        else if constexpr (count == 20)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20);
+        }
+        else if constexpr (count == 21)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                   o21] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21);
+        }
+        else if constexpr (count == 22)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21,
+                   o22] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22);
+        }
+        else if constexpr (count == 23)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23);
+        }
+        else if constexpr (count == 24)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24);
+        }
+        else if constexpr (count == 25)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25);
+        }
+        else if constexpr (count == 26)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26);
+        }
+        else if constexpr (count == 27)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27);
+        }
+        else if constexpr (count == 28)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28);
+        }
+        else if constexpr (count == 29)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29);
+        }
+        else if constexpr (count == 30)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30);
+        }
+        else if constexpr (count == 31)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31);
+        }
+        else if constexpr (count == 32)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32);
+        }
+        else if constexpr (count == 33)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33);
+        }
+        else if constexpr (count == 34)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34);
+        }
+        else if constexpr (count == 35)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35);
+        }
+        else if constexpr (count == 36)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36);
+        }
+        else if constexpr (count == 37)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37);
+        }
+        else if constexpr (count == 38)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38);
+        }
+        else if constexpr (count == 39)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39);
+        }
+        else if constexpr (count == 40)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40);
+        }
+        else if constexpr (count == 41)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40,
+                   o41] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41);
+        }
+        else if constexpr (count == 42)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41,
+                   o42] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42);
+        }
+        else if constexpr (count == 43)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43);
+        }
+        else if constexpr (count == 44)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44);
+        }
+        else if constexpr (count == 45)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45);
+        }
+        else if constexpr (count == 46)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46);
+        }
+        else if constexpr (count == 47)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47);
+        }
+        else if constexpr (count == 48)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48);
+        }
+        else if constexpr (count == 49)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49);
+        }
+        else if constexpr (count == 50)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50);
+        }
+        else if constexpr (count == 51)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51);
+        }
+        else if constexpr (count == 52)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52);
+        }
+        else if constexpr (count == 53)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53);
+        }
+        else if constexpr (count == 54)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54);
+        }
+        else if constexpr (count == 55)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55);
+        }
+        else if constexpr (count == 56)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56);
+        }
+        else if constexpr (count == 57)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57);
+        }
+        else if constexpr (count == 58)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58);
+        }
+        else if constexpr (count == 59)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59);
+        }
+        else if constexpr (count == 60)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60);
+        }
+        else if constexpr (count == 61)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60,
+                   o61] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60, o61);
+        }
+        else if constexpr (count == 62)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61,
+                   o62] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60, o61, o62);
+        }
+        else if constexpr (count == 63)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62,
+                   o63] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60, o61, o62, o63);
+        }
+        else if constexpr (count == 64)
+        {
+            auto &[o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22,
+                   o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38, o39, o40, o41, o42,
+                   o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56, o57, o58, o59, o60, o61, o62,
+                   o63, o64] = aObject;
+            return std::tie(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20,
+                            o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, o33, o34, o35, o36, o37, o38,
+                            o39, o40, o41, o42, o43, o44, o45, o46, o47, o48, o49, o50, o51, o52, o53, o54, o55, o56,
+                            o57, o58, o59, o60, o61, o62, o63, o64);
+        }
+    }
+};
+
+/*
+    Deleter for smart pointers whose objects may be allocated from a memory resource (pool, slab etc...)
+
+    Without a memory resource it behaves like std::default_delete, so it can own objects allocated with new too. It
+    keeps the resource, the size and the alignment, so the std::unique_ptr using it is 4 times bigger.
+*/
+template <typename Type> class Deleter
+{
+    template <typename> friend class Deleter;
+
+  public:
+    constexpr Deleter() noexcept = default;
+
+    template <typename TypeDerived>
+        requires std::convertible_to<TypeDerived *, Type *>
+    constexpr Deleter(const std::default_delete<TypeDerived> &) noexcept
+    {
+    }
+
+    constexpr Deleter(std::pmr::memory_resource *aMemoryResource, const std::size_t aSize,
+                      const std::size_t aAlignment) noexcept
+        : mMemoryResource(aMemoryResource), mSize(aSize), mAlignment(aAlignment)
+    {
+    }
+
+    template <typename TypeDerived>
+        requires std::convertible_to<TypeDerived *, Type *>
+    constexpr Deleter(const Deleter<TypeDerived> &aDeleter) noexcept
+        : mMemoryResource(aDeleter.mMemoryResource), mSize(aDeleter.mSize), mAlignment(aDeleter.mAlignment)
+    {
+    }
+
+    constexpr void operator()(Type *aObject) const
+    {
+        if (!mMemoryResource)
+        {
+            delete aObject;
+            return;
+        }
+
+        // the memory starts at the most derived object, that could be before a base class
+        void *object{};
+        if constexpr (std::is_polymorphic_v<Type>)
+        {
+            object = dynamic_cast<void *>(aObject);
+        }
+        else
+        {
+            object = aObject;
+        }
+
+        std::destroy_at(aObject);
+        mMemoryResource->deallocate(object, mSize, mAlignment);
+    }
+
+  private:
+    std::pmr::memory_resource *mMemoryResource{};
+    std::size_t mSize{};
+    std::size_t mAlignment{};
+};
+
+/*
+    Options and state shared by a stream and every stream of the nested streamables inside it
+
+    The context must outlive the streams using it.
+*/
+class StreamContext
+{
+  public:
+    enum class Option : uint8_t
+    {
+        NONE = 0,
+        // shared pointers to the same object are written once, then referenced by their identity
+        IDENTITY = 1 << 0,
+        // the elements of ranges of objects of known size are padded to their alignment, so they can be used in place
+        ALIGNED = 1 << 1,
+        // equal objects are written in equal bytes, unordered containers are sorted and floating points normalized
+        CANONICAL = 1 << 2
+    };
+
+    enum class Status : uint8_t
+    {
+        OK,
+        // a field or a count was cut by the end of the stream
+        TRUNCATED,
+        // a count asks for more bytes than there are left
+        INVALID_COUNT,
+        // a variant alternative, derived streamable or shared object identity that doesn't exist
+        INVALID_INDEX,
+        // a limit of the reader was exceeded
+        OVER_LIMIT,
+        // a span can't point to elements that are not aligned in the stream
+        MISALIGNED
+    };
+
+    // the budget of a deserialization, the bytes are the sizes of the objects allocated for ranges and pointers
+    struct Limits
+    {
+        Size::size_max bytes = std::numeric_limits<Size::size_max>::max();
+        Size::size_max count = std::numeric_limits<Size::size_max>::max();
+        Size::size_max depth = std::numeric_limits<Size::size_max>::max();
+    };
+
+    // the first error of a deserialization and its offset in the stream
+    struct Result
+    {
+        Status status = Status::OK;
+        Size::size_max offset{};
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return status == Status::OK;
+        }
+    };
+
+    StreamContext() noexcept = default;
+
+    /*
+        The objects allocated by the reader for smart pointers will use the memory resource: std::shared_ptr and
+        std::unique_ptr with hbann::Deleter, the ones with std::default_delete and the raw pointers still use new
+    */
+    explicit StreamContext(std::pmr::memory_resource *aMemoryResource) noexcept : mMemoryResource(aMemoryResource)
+    {
+    }
+
+    explicit StreamContext(const Option aOptions, std::pmr::memory_resource *aMemoryResource = nullptr) noexcept
+        : mOptions(aOptions), mMemoryResource(aMemoryResource)
+    {
+    }
+
+    [[nodiscard]] constexpr bool Has(const Option aOption) const noexcept
+    {
+        return static_cast<uint8_t>(mOptions) & static_cast<uint8_t>(aOption);
+    }
+
+    [[nodiscard]] constexpr std::pmr::memory_resource *GetMemoryResource() const noexcept
+    {
+        return mMemoryResource;
+    }
+
+    constexpr StreamContext &SetLimits(const Limits &aLimits) noexcept
+    {
+        mLimits = aLimits;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr const Limits &GetLimits() const noexcept
+    {
+        return mLimits;
+    }
+
+    // forgets the state of the last serialization/deserialization, the options are kept
+    void Clear() noexcept
+    {
+        mIdentitiesWritten.clear();
+        mIdentitiesWrittenCount = 0;
+        mIdentitiesRead.clear();
+
+        mStatus = Status::OK;
+        mStatusPosition = nullptr;
+
+        mAllocated = 0;
+        mDepth = 0;
+    }
+
+  private:
+    friend class StreamWriter;
+    friend class StreamReader;
+    friend class IStreamable;
+
+    Option mOptions = Option::NONE;
+    std::pmr::memory_resource *mMemoryResource{};
+
+    Limits mLimits{};
+    Size::size_max mAllocated{};
+    Size::size_max mDepth{};
+
+    // the identities start from 1, 0 being written before objects written for the first time
+    std::unordered_map<const void *, std::pair<Size::size_max, const std::type_info *>> mIdentitiesWritten;
+    Size::size_max mIdentitiesWrittenCount{};
+    // the objects read are kept with their type, so a back reference can't alias an object of another type
+    std::vector<std::pair<std::shared_ptr<void>, std::type_index>> mIdentitiesRead;
+
+    // the reader records the first error instead of throwing it
+    bool mThrows = true;
+    Status mStatus = Status::OK;
+    const uint8_t *mStatusPosition{};
+
+    constexpr void Fail(const Status aStatus, const uint8_t *aPosition) noexcept
+    {
+        if (mStatus == Status::OK)
+        {
+            mStatus = aStatus;
+            mStatusPosition = aPosition;
+        }
+    }
+};
+
+[[nodiscard]] constexpr StreamContext::Option operator|(const StreamContext::Option aLeft,
+                                                        const StreamContext::Option aRight) noexcept
+{
+    return static_cast<StreamContext::Option>(static_cast<uint8_t>(aLeft) | static_cast<uint8_t>(aRight));
+}
+
+class Stream
+{
+    friend class StreamReader;
+
+  public:
+    using vector = std::vector<uint8_t>;
+    using span = std::span<const uint8_t>;
+    using stream = std::variant<vector, span>;
+
+    constexpr Stream() noexcept : mStream(vector())
+    {
+    }
+
+    constexpr Stream(const Stream &) noexcept
+    {
+    }
+
+    constexpr explicit Stream(const span aSpan) noexcept : mStream(aSpan)
+    {
+    }
+
+    constexpr explicit Stream(StreamContext &aContext) noexcept : mStream(vector()), mContext(&aContext)
+    {
+    }
+
+    constexpr Stream(const span aSpan, StreamContext &aContext) noexcept : mStream(aSpan), mContext(&aContext)
+    {
+    }
+
+    constexpr Stream(Stream &&aStream) noexcept
+    {
+        *this = std::move(aStream);
+    }
+
+    constexpr vector &&Release() noexcept
+    {
+        return std::move(GetStream());
+    }
+
+    template <typename FunctionSeek>
+    constexpr decltype(auto) Peek(FunctionSeek &&aFunctionSeek, const Size::size_max aOffset = 0)
+    {
+        ThrowIfCantRead(aOffset);
+
+        const auto readIndex = mReadIndex;
+        mReadIndex += aOffset;
+        aFunctionSeek(readIndex);
+        mReadIndex = readIndex;
+
+        return *this;
+    }
+
+    constexpr decltype(auto) Reserve(const Size::size_max aSize)
+    {
+        GetStream().reserve(aSize);
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto View() noexcept
+    {
+        const auto spen = std::get_if<span>(&mStream);
+        return spen ? *spen : GetStream();
+    }
+
+    [[nodiscard]] constexpr StreamContext *GetContext() const noexcept
+    {
+        return mContext;
+    }
+
+    [[nodiscard]] constexpr auto CanRead(const Size::size_max aSize) noexcept
+    {
+        const auto view = View();
+        return mReadIndex + aSize <= view.size();
+    }
+
+    [[nodiscard]] constexpr Size::size_max Remaining() noexcept
+    {
+        const auto view = View();
+        return mReadIndex < view.size() ? view.size() - mReadIndex : 0;
+    }
+
+    [[nodiscard]] constexpr const uint8_t *Position() noexcept
+    {
+        return View().data() + mReadIndex;
+    }
+
+    // nothing else will be read
+    constexpr decltype(auto) Skip() noexcept
+    {
+        mReadIndex = View().size();
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto Read(const Size::size_max aSize)
+    {
+        ThrowIfCantRead(aSize);
+
+        mReadIndex += aSize;
+        return span{View().data() + (mReadIndex - aSize), aSize};
+    }
+
+    // the nested stream shares our context
+    [[nodiscard]] constexpr Stream ReadStream(const Size::size_max aSize)
+    {
+        Stream streamNested(Read(aSize));
+        streamNested.mContext = mContext;
+
+        return streamNested;
+    }
+
+    [[nodiscard]] constexpr auto Current()
+    {
+        ThrowIfCantRead(1);
+        return View()[mReadIndex];
+    }
+
+    constexpr decltype(auto) Write(const span aSpan)
+    {
+        GetStream().insert(GetStream().end(), aSpan.data(), aSpan.data() + aSpan.size());
+        return *this;
+    }
+
+    // the bytes are written in place by the caller
+    [[nodiscard]] constexpr uint8_t *Extend(const Size::size_max aSize)
+    {
+        const auto size = GetStream().size();
+        GetStream().resize(size + aSize);
+
+        return GetStream().data() + size;
+    }
+
+    constexpr decltype(auto) Insert(const Size::size_max aOffset, const span aSpan)
+    {
+        GetStream().insert(GetStream().begin() + aOffset, aSpan.data(), aSpan.data() + aSpan.size());
+        return *this;
+    }
+
+    constexpr Stream &operator=(const Stream &) noexcept
+    {
+        return *this;
+    }
+
+    constexpr Stream &operator=(Stream &&aStream) noexcept
+    {
+        mStream = std::move(aStream.mStream);
+        mReadIndex = aStream.mReadIndex;
+        mContext = aStream.mContext;
+
+        return *this;
+    }
+
+    constexpr decltype(auto) Clear() noexcept
+    {
+        GetStream().clear();
+        return *this;
+    }
+
+  private:
+    stream mStream{};
+    Size::size_max mReadIndex{};
+    StreamContext *mContext{};
+
+    constexpr vector &GetStream() noexcept
+    {
+        // if crashed here --> it's read only (span)
+        return std::get<vector>(mStream);
+    }
+
+    constexpr void ThrowIfCantRead(const Size::size_max aSize)
+    {
+        if (!CanRead(aSize))
+        {
+            throw std::out_of_range("Invalid Stream subscript!");
+        }
+    }
+};
+
+class SizeFinder
+{
+  public:
+    template <typename Type> [[nodiscard]] static consteval Size::size_max FindRangeRank() noexcept
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        // fixed extents are not prefixed by a count, they are part of their elements
+        if constexpr (std::ranges::range<TypeRaw> && !is_fixed_extent<TypeRaw>)
+        {
+            return 1 + FindRangeRank<range_value_t<TypeRaw>>();
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    // the alignment of an object in an aligned stream, only the objects of known size are copied as they are
+    template <typename Type> [[nodiscard]] static consteval size_t FindAlignment() noexcept
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        if constexpr (is_known_size<TypeRaw>)
+        {
+            return std::min(alignof(TypeRaw), ALIGNMENT_MAX);
+        }
+        else
+        {
+            return 1;
+        }
+    }
+
+    // the encoded strings are written as bytes
+    template <typename Type> [[nodiscard]] static consteval size_t FindRangeAlignment() noexcept
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        if constexpr (is_wide_string<TypeRaw> || is_path<TypeRaw>)
+        {
+            return 1;
+        }
+        else
+        {
+            return FindAlignment<range_value_t<TypeRaw>>();
+        }
+    }
+
+    // the type of the objects in the ranges of the last dimension, wrapped in a std::type_identity
+    template <typename Type> [[nodiscard]] static consteval auto FindRangeElement() noexcept
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        if constexpr (FindRangeRank<TypeRaw>())
+        {
+            return FindRangeElement<range_value_t<TypeRaw>>();
+        }
+        else
+        {
+            return std::type_identity<TypeRaw>{};
+        }
+    }
+
+    // the least bytes an object of type Type is written in, so counts asking for more than there is can be rejected
+    template <typename Type> [[nodiscard]] static consteval Size::size_max FindMinSize() noexcept
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        if constexpr (is_optional_v<TypeRaw> || is_variant_v<TypeRaw>)
+        {
+            return 1;
+        }
+        else if constexpr (is_tuple_v<TypeRaw>)
+        {
+            return []<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                return (Size::size_max{} + ... + FindMinSize<std::tuple_element_t<vIndexes, TypeRaw>>());
+            }(std::make_index_sequence<std::tuple_size_v<TypeRaw>>{});
+        }
+        else if constexpr (is_pair_v<TypeRaw>)
+        {
+            return FindMinSize<typename TypeRaw::first_type>() + FindMinSize<typename TypeRaw::second_type>();
+        }
+        else if constexpr (has_streamable_fields<TypeRaw>)
+        {
+            return FindMinSize<decltype(StreamableFields(std::declval<TypeRaw &>()))>();
+        }
+        else if constexpr (is_reflectable<TypeRaw>)
+        {
+            return FindMinSize<decltype(Reflector::Tie(std::declval<TypeRaw &>()))>();
+        }
+        else if constexpr (is_any_pointer<TypeRaw>)
+        {
+            // shared objects written before are only a reference to them
+            return std::min<Size::size_max>(1, FindMinSize<typename std::pointer_traits<TypeRaw>::element_type>());
+        }
+        else if constexpr (is_known_size<TypeRaw>)
+        {
+            return sizeof(TypeRaw);
+        }
+        else if constexpr (is_fixed_array<TypeRaw>)
+        {
+            using TypeValueType = range_value_t<TypeRaw>;
+            return sizeof(TypeRaw) / sizeof(TypeValueType) * FindMinSize<TypeValueType>();
+        }
+        else
+        {
+            // ranges and streamables start with a count
+            return 1;
+        }
+    }
+
+    // the count of the leading objects of known size, they can be written and read as a single block
+    template <typename... Types> [[nodiscard]] static consteval size_t FindKnownSizeRun() noexcept
+    {
+        size_t run{};
+        for (const auto knownSize : {is_known_size<std::remove_cvref_t<Types>>...})
+        {
+            if (!knownSize)
+            {
+                break;
+            }
+
+            run++;
+        }
+
+        return run;
+    }
+
+    template <typename... Types> [[nodiscard]] static consteval size_t FindOptionalCount() noexcept
+    {
+        return (size_t{} + ... + is_optional_v<std::remove_cvref_t<Types>>);
+    }
+
+    template <std::ranges::range Range>
+    [[nodiscard]] static constexpr Size::size_max GetRangeCount(const Range &aRange) noexcept
+    {
+        using RangeRaw = std::remove_cvref_t<Range>;
+
+        if constexpr (has_method_size<RangeRaw>)
+        {
+            return std::ranges::size(aRange);
+        }
+        else if constexpr (is_path<RangeRaw>)
+        {
+            return aRange.native().size();
+        }
+        else
+        {
+            static_assert(always_false<RangeRaw>, "Tried to get the range count from an unknown object!");
+        }
+    }
+};
+
+/*
+    Format: a tagged field is a key followed by the field, the key is a size made of the field id and the wire kind
+
+    The id is a 16 bits hash of the field name, the wire kind is the last 3 bits and it tells how the field can be
+   skipped: fixed fields are 1, 2, 4 or 8 bytes long, delimited fields are prefixed by their size in bytes.
+*/
+class Tag
+{
+  public:
+    using id = uint16_t;
+
+    enum class Kind : uint8_t
+    {
+        FIXED_1,
+        FIXED_2,
+        FIXED_4,
+        FIXED_8,
+        DELIMITED
+    };
+
+    // the ids of the names of the fields separated by commas, as the macros stringify them
+    template <size_t vCount> [[nodiscard]] static consteval auto FindIds(const std::string_view aNames)
+    {
+        std::array<id, vCount> ids{};
+
+        size_t index{};
+        for (const auto name : std::views::split(aNames, ','))
+        {
+            ids[index++] = FindId(Trim(std::string_view(name.begin(), name.end())));
+        }
+
+        // a renamed field is another field, but two fields must not hash the same
+        for (size_t i = 0; i < vCount; i++)
+        {
+            for (size_t j = i + 1; j < vCount; j++)
+            {
+                if (ids[i] == ids[j])
+                {
+                    throw std::out_of_range("Two fields have the same tag id, rename one of them!");
+                }
+            }
+        }
+
+        return ids;
+    }
+
+    template <typename Type> [[nodiscard]] static consteval Kind FindKind() noexcept
+    {
+        if constexpr (is_known_size<Type> && sizeof(Type) == 1)
+        {
+            return Kind::FIXED_1;
+        }
+        else if constexpr (is_known_size<Type> && sizeof(Type) == 2)
+        {
+            return Kind::FIXED_2;
+        }
+        else if constexpr (is_known_size<Type> && sizeof(Type) == 4)
+        {
+            return Kind::FIXED_4;
+        }
+        else if constexpr (is_known_size<Type> && sizeof(Type) == 8)
+        {
+            return Kind::FIXED_8;
+        }
+        else
+        {
+            return Kind::DELIMITED;
+        }
+    }
+
+    [[nodiscard]] static constexpr Size::size_max FindFixedSize(const Kind aKind) noexcept
+    {
+        return Size::size_max{1} << static_cast<uint8_t>(aKind);
+    }
+
+    [[nodiscard]] static constexpr Size::size_max MakeKey(const id aId, const Kind aKind) noexcept
+    {
+        return Size::size_max{aId} << 3 | static_cast<uint8_t>(aKind);
+    }
+
+    [[nodiscard]] static constexpr id GetId(const Size::size_max aKey) noexcept
+    {
+        return static_cast<id>(aKey >> 3);
+    }
+
+    [[nodiscard]] static constexpr Kind GetKind(const Size::size_max aKey) noexcept
+    {
+        return static_cast<Kind>(aKey & 0b111);
+    }
+
+  private:
+    // FNV-1a folded to 16 bits
+    [[nodiscard]] static consteval id FindId(const std::string_view aName) noexcept
+    {
+        uint32_t hash = 2166136261u;
+        for (const auto character : aName)
+        {
+            hash = (hash ^ static_cast<uint8_t>(character)) * 16777619u;
+        }
+
+        return static_cast<id>(hash ^ hash >> 16);
+    }
+
+    [[nodiscard]] static consteval std::string_view Trim(std::string_view aName) noexcept
+    {
+        while (!aName.empty() && aName.front() == ' ')
+        {
+            aName.remove_prefix(1);
+        }
+
+        while (!aName.empty() && aName.back() == ' ')
+        {
+            aName.remove_suffix(1);
+        }
+
+        return aName;
+    }
+};
+
+/*
+    Encodes objects in bytes that compare with memcmp (and then by their size) like the objects compare with operator<
+
+    The numbers are big endian with the sign bit flipped, the strings are terminated by 0 0 (a 0 in them is followed
+    by 0xFF) and the elements of the other ranges by a 1 before each of them and a 0 at the end, so every encoding is a
+    prefix of no other and the objects can be concatenated (ex.: the fields of a record). It's not read back.
+*/
+class Key
+{
+  public:
+    template <typename... Types> [[nodiscard]] static constexpr std::vector<uint8_t> Encode(const Types &...aObjects)
+    {
+        std::vector<uint8_t> bytes;
+        (EncodeObject(bytes, aObjects), ...);
+
+        return bytes;
+    }
+
+  private:
+    template <typename Type> static constexpr void EncodeObject(std::vector<uint8_t> &aBytes, const Type &aObject)
+    {
+        if constexpr (std::is_same_v<Type, bool>)
+        {
+            aBytes.push_back(aObject);
+        }
+        else if constexpr (std::is_enum_v<Type>)
+        {
+            EncodeObject(aBytes, static_cast<std::underlying_type_t<Type>>(aObject));
+        }
+        else if constexpr (std::unsigned_integral<Type>)
+        {
+            EncodeUnsigned(aBytes, aObject);
+        }
+        else if constexpr (std::signed_integral<Type>)
+        {
+            // the negatives are before the positives
+            using TypeUnsigned = std::make_unsigned_t<Type>;
+            EncodeUnsigned(aBytes, static_cast<TypeUnsigned>(static_cast<TypeUnsigned>(aObject) ^ FindSignBit<Type>()));
+        }
+        else if constexpr (std::is_same_v<Type, float> || std::is_same_v<Type, double>)
+        {
+            using TypeUnsigned = std::conditional_t<sizeof(Type) == sizeof(uint32_t), uint32_t, uint64_t>;
+
+            // -0 is 0 and every NaN is the quiet one, after +infinity, the bits of the negatives are flipped so a
+            // bigger magnitude is smaller
+            auto object = aObject;
+            if (object != object)
+            {
+                object = std::numeric_limits<Type>::quiet_NaN();
+            }
+            else if (object == Type{})
+            {
+                object = Type{};
+            }
+
+            const auto bits = std::bit_cast<TypeUnsigned>(object);
+            constexpr auto signBit = FindSignBit<TypeUnsigned>();
+            EncodeUnsigned(aBytes, static_cast<TypeUnsigned>(bits & signBit ? ~bits : bits | signBit));
+        }
+        else if constexpr (is_optional_v<Type>)
+        {
+            aBytes.push_back(aObject.has_value());
+            if (aObject)
+            {
+                EncodeObject(aBytes, *aObject);
+            }
+        }
+        else if constexpr (is_tuple_v<Type> || is_pair_v<Type>)
+        {
+            std::apply([&](const auto &...aObjects) { (EncodeObject(aBytes, aObjects), ...); }, aObject);
+        }
+        else if constexpr (is_basic_string_v<Type> && sizeof(typename Type::value_type) == sizeof(uint8_t))
+        {
+            // the characters of strings are compared as unsigned
+            for (const auto character : aObject)
+            {
+                aBytes.push_back(static_cast<uint8_t>(character));
+                if (!aBytes.back())
+                {
+                    aBytes.push_back(0xFF);
+                }
+            }
+
+            // the terminator sorts before the escaped 0 of a longer string
+            aBytes.insert(aBytes.end(), {0, 0});
+        }
+        else if constexpr (std::ranges::range<Type>)
+        {
+            for (const auto &object : aObject)
+            {
+                aBytes.push_back(1);
+                EncodeObject(aBytes, object);
+            }
+
+            aBytes.push_back(0);
+        }
+        else
+        {
+            static_assert(always_false<Type>, "Type can't be encoded in an ordered key!");
+        }
+    }
+
+    template <typename Type> [[nodiscard]] static consteval auto FindSignBit() noexcept
+    {
+        using TypeUnsigned = std::make_unsigned_t<Type>;
+        return static_cast<TypeUnsigned>(TypeUnsigned{1} << (std::numeric_limits<TypeUnsigned>::digits - 1));
+    }
+
+    template <typename Type> static constexpr void EncodeUnsigned(std::vector<uint8_t> &aBytes, const Type aObject)
+    {
+        for (auto i = static_cast<int>(sizeof(Type)) - 1; i >= 0; i--)
+        {
+            aBytes.push_back(static_cast<uint8_t>(aObject >> i * 8));
+        }
+    }
+};
+
+/*
+    N-D array of objects of known size stored contiguously in row major order (like a std::mdspan over its own buffer)
+
+    It's written as its shape followed by its elements in a single block, the same as a Rectangular range, so a
+    rectangular range of ranges can be read back flat.
+*/
+template <typename Type, size_t vRank> class Dense
+{
+    static_assert(vRank, "A dense array must have at least a dimension!");
+    static_assert(is_known_size<Type>, "Type is not an object of known size!");
+
+  public:
+    using value_type = Type;
+    using shape_type = std::array<Size::size_max, vRank>;
+
+    static constexpr auto rank = vRank;
+
+    constexpr Dense() noexcept = default;
+
+    constexpr explicit Dense(const shape_type &aShape)
+    {
+        Reshape(aShape);
+    }
+
+    [[nodiscard]] constexpr const shape_type &GetShape() const noexcept
+    {
+        return mShape;
+    }
+
+    [[nodiscard]] constexpr std::span<Type> GetElements() noexcept
+    {
+        return mElements;
+    }
+
+    [[nodiscard]] constexpr std::span<const Type> GetElements() const noexcept
+    {
+        return mElements;
+    }
+
+    constexpr void Reshape(const shape_type &aShape)
+    {
+        mShape = aShape;
+
+        Size::size_max count{1};
+        for (const auto extent : aShape)
+        {
+            count *= extent;
+        }
+
+        mElements.resize(count);
+    }
+
+    template <typename... Indexes>
+        requires(sizeof...(Indexes) == vRank)
+    [[nodiscard]] constexpr Type &operator()(const Indexes... aIndexes) noexcept
+    {
+        return mElements[FindIndex(aIndexes...)];
+    }
+
+    template <typename... Indexes>
+        requires(sizeof...(Indexes) == vRank)
+    [[nodiscard]] constexpr const Type &operator()(const Indexes... aIndexes) const noexcept
+    {
+        return mElements[FindIndex(aIndexes...)];
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Dense &) const = default;
+
+  private:
+    shape_type mShape{};
+    std::vector<Type> mElements;
+
+    template <typename... Indexes> [[nodiscard]] constexpr size_t FindIndex(const Indexes... aIndexes) const noexcept
+    {
+        size_t index{}, dimension{};
+        ((index = index * mShape[dimension++] + static_cast<size_t>(aIndexes)), ...);
+
+        return index;
+    }
+};
+
+/*
+    Marks a range of ranges (ex.: std::vector<std::vector<double>>) whose rows have the same count
+
+    It's written as its shape followed by the elements of the rows, without a count per row, so it can be read back in
+    place or flat in a Dense array. Ex.: mStreamWriter.WriteAll(hbann::Rectangular(mMatrix));
+*/
+template <typename Type> class Rectangular
+{
+    static_assert(SizeFinder::FindRangeRank<Type>(), "Type is not a range!");
+
+  public:
+    static constexpr auto rank = SizeFinder::FindRangeRank<Type>();
+
+    using range_type = Type;
+    using value_type = typename decltype(SizeFinder::FindRangeElement<Type>())::type;
+    using shape_type = std::array<Size::size_max, rank>;
+
+    constexpr explicit Rectangular(Type &aRange) noexcept : mRange(&aRange)
+    {
+    }
+
+    // the rows are checked while finding the shape so a jagged range can't be read back wrong
+    [[nodiscard]] constexpr shape_type FindShape() const
+    {
+        shape_type shape{};
+        FindShape(*mRange, shape);
+
+        if (!IsShape(*mRange, shape))
+        {
+            throw std::out_of_range("The range is not rectangular!");
+        }
+
+        return shape;
+    }
+
+    constexpr void Reshape(const shape_type &aShape)
+    {
+        Reshape(*mRange, aShape);
+    }
+
+    // calls aFunction with every row of the last dimension, they are contiguous
+    template <typename Function> constexpr void ForEachRow(Function &&aFunction) const
+    {
+        ForEachRow(*mRange, aFunction);
+    }
+
+  private:
+    Type *mRange{};
+
+    template <size_t vDimension = 0, typename Range>
+    static constexpr void FindShape(const Range &aRange, shape_type &aShape) noexcept
+    {
+        aShape[vDimension] = SizeFinder::GetRangeCount(aRange);
+        if constexpr (vDimension + 1 < rank)
+        {
+            if (aShape[vDimension])
+            {
+                FindShape<vDimension + 1>(*std::ranges::begin(aRange), aShape);
+            }
+        }
+    }
+
+    template <size_t vDimension = 0, typename Range>
+    [[nodiscard]] static constexpr bool IsShape(const Range &aRange, const shape_type &aShape) noexcept
+    {
+        if (SizeFinder::GetRangeCount(aRange) != aShape[vDimension])
+        {
+            return false;
+        }
+
+        if constexpr (vDimension + 1 < rank)
+        {
+            return std::ranges::all_of(aRange, [&](const auto &aRow) { return IsShape<vDimension + 1>(aRow, aShape); });
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    template <size_t vDimension = 0, typename Range>
+    static constexpr void Reshape(Range &aRange, const shape_type &aShape)
+    {
+        static_assert(has_method_resize<Range>, "The ranges of a rectangular range must be resizable!");
+
+        aRange.resize(aShape[vDimension]);
+        if constexpr (vDimension + 1 < rank)
+        {
+            for (auto &row : aRange)
+            {
+                Reshape<vDimension + 1>(row, aShape);
+            }
+        }
+    }
+
+    template <size_t vDimension = 0, typename Range, typename Function>
+    static constexpr void ForEachRow(Range &aRange, Function &aFunction)
+    {
+        if constexpr (vDimension + 1 < rank)
+        {
+            for (auto &row : aRange)
+            {
+                ForEachRow<vDimension + 1>(row, aFunction);
+            }
+        }
+        else
+        {
+            static_assert(std::ranges::contiguous_range<Range> && is_known_size<range_value_t<Range>>,
+                          "The rows of a rectangular range must be contiguous and of objects of known size!");
+
+            aFunction(aRange);
+        }
+    }
+};
+
+/*
+    Marks a range of records (streamables, classes with fields or aggregates) to be written as a column per field
+
+    It's written as the count of records followed by every column without a count, the columns of objects of known size
+    being a single block, so the same bytes can be read back as records or straight in a tuple of ranges.
+    Ex.: mStreamWriter.WriteAll(hbann::Columnar(mRecords));
+         mStreamReader.ReadAll(hbann::Columnar(std::tie(mIds, mValues)));
+*/
+template <typename Type> class Columnar
+{
+  public:
+    constexpr explicit Columnar(Type &aRecords) noexcept
+        requires(!is_tuple_v<Type>)
+        : mColumns(&aRecords)
+    {
+    }
+
+    constexpr explicit Columnar(const Type &aColumns) noexcept
+        requires is_tuple_v<Type>
+        : mColumns(aColumns)
+    {
+    }
+
+    [[nodiscard]] static consteval Size::size_max FindMinSize() noexcept
+    {
+        return FindSize([]<typename TypeField> { return SizeFinder::FindMinSize<TypeField>(); });
+    }
+
+    [[nodiscard]] static consteval Size::size_max FindRecordSize() noexcept
+    {
+        return FindSize([]<typename TypeField> { return sizeof(TypeField); });
+    }
+
+    [[nodiscard]] constexpr Size::size_max FindCount() const
+    {
+        if constexpr (is_tuple_v<Type>)
+        {
+            const auto count = SizeFinder::GetRangeCount(std::get<0>(mColumns));
+            if (!std::apply([&](auto &...aColumns) { return ((SizeFinder::GetRangeCount(aColumns) == count) && ...); },
+                            mColumns))
+            {
+                throw std::out_of_range("The columns don't have the same count!");
+            }
+
+            return count;
+        }
+        else
+        {
+            return SizeFinder::GetRangeCount(*mColumns);
+        }
+    }
+
+    constexpr void Resize(const Size::size_max aCount)
+    {
+        if constexpr (is_tuple_v<Type>)
+        {
+            std::apply([&](auto &...aColumns) { (aColumns.resize(aCount), ...); }, mColumns);
+        }
+        else
+        {
+            mColumns->resize(aCount);
+        }
+    }
+
+    // calls aFunction with every column, a range of the fields of the records or a range of the tuple
+    template <typename Function> constexpr void ForEachColumn(Function &&aFunction) const
+    {
+        if constexpr (is_tuple_v<Type>)
+        {
+            std::apply([&](auto &...aColumns) { (aFunction(aColumns), ...); }, mColumns);
+        }
+        else
+        {
+            [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                (aFunction(*mColumns | std::views::transform([](auto &aRecord) -> decltype(auto) {
+                     return std::get<vIndexes>(Reflector::TieFields(aRecord));
+                 })),
+                 ...);
+            }(std::make_index_sequence<std::tuple_size_v<typename decltype(FindFields())::type>>{});
+        }
+    }
+
+  private:
+    std::conditional_t<is_tuple_v<Type>, Type, Type *> mColumns{};
+
+    // the fields of a record or the columns of the tuple, wrapped in a std::type_identity
+    [[nodiscard]] static consteval auto FindFields() noexcept
+    {
+        if constexpr (is_tuple_v<Type>)
+        {
+            return std::type_identity<Type>{};
+        }
+        else
+        {
+            using TypeFields = decltype(Reflector::TieFields(std::declval<std::ranges::range_reference_t<Type>>()));
+            return std::type_identity<TypeFields>{};
+        }
+    }
+
+    template <typename Function> [[nodiscard]] static consteval Size::size_max FindSize(Function &&aFunction) noexcept
+    {
+        using TypeFields = typename decltype(FindFields())::type;
+
+        return [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+            if constexpr (is_tuple_v<Type>)
+            {
+                return (Size::size_max{} + ... +
+                        aFunction.template operator()<range_value_t<
+                            std::remove_cvref_t<std::tuple_element_t<vIndexes, TypeFields>>>>());
+            }
+            else
+            {
+                return (Size::size_max{} + ... +
+                        aFunction.template operator()<
+                            std::remove_cvref_t<std::tuple_element_t<vIndexes, TypeFields>>>());
+            }
+        }(std::make_index_sequence<std::tuple_size_v<TypeFields>>{});
+    }
+};
+
+class StreamReader
+{
+  public:
+    constexpr explicit StreamReader(Stream &aStream) noexcept : mStream(&aStream)
+    {
+    }
+
+    constexpr StreamReader(const StreamReader &aStreamReader) noexcept : mStream(aStreamReader.mStream)
+    {
+    }
+
+    constexpr StreamReader(StreamReader &&aStreamReader) noexcept
+    {
+        *this = std::move(aStreamReader);
+    }
+
+    template <typename Type, typename... Types> constexpr void ReadAll(Type &&aObject, Types &&...aObjects)
+    {
+        using TypeRaw = std::remove_cvref_t<Type>;
+
+        Begin();
+
+        // consecutive objects of known size are read with a single bounds check and copy, that can't be made at
+        // compile time, an older stream may end inside the run too, then the objects are read one by one
+        if constexpr (constexpr auto run = SizeFinder::FindKnownSizeRun<Type, Types...>(); run > 1)
+        {
+            auto objects = std::tie(aObject, aObjects...);
+            if (!std::is_constant_evaluated() && ReadKnownSizeRun(objects, std::make_index_sequence<run>{}))
+            {
+                [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                    ReadAll(std::get<run + vIndexes>(objects)...);
+                }(std::make_index_sequence<sizeof...(Types) + 1 - run>{});
+
+                return;
+            }
+        }
+
+        Read<TypeRaw>(aObject);
+
+        if constexpr (sizeof...(aObjects))
+        {
+            ReadAll(aObjects...);
+        }
+    }
+
+    // reads the objects written by StreamWriter::WriteTagged in any order, the unknown ones are skipped
+    template <size_t vCount, typename... Types>
+    constexpr void ReadTagged(const std::array<Tag::id, vCount> &aIds, Types &...aObjects)
+    {
+        static_assert(vCount == sizeof...(Types), "There must be an id for every object!");
+
+        Begin();
+
+        const auto count = ReadCount();
+        if (!CanReadCount(count, sizeof(uint8_t)))
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto key = ReadCount();
+            const auto id = Tag::GetId(key);
+            const auto kind = Tag::GetKind(key);
+
+            size_t index{};
+            if (!((aIds[index] == id ? (ReadTaggedObject(kind, aObjects), true) : (index++, false)) || ...))
+            {
+                SkipTaggedObject(kind);
+            }
+        }
+    }
+
+    // reads the objects written by StreamWriter::WriteSparse, the present optionals are read in place
+    template <typename... Types> constexpr void ReadSparse(Types &...aObjects)
+    {
+        Begin();
+
+        std::array<uint8_t, (SizeFinder::FindOptionalCount<Types...>() + 7) / 8> presence{};
+
+        // the objects were not written by an older version
+        if (!mStream->CanRead(presence.size()))
+        {
+            if (mStream->Remaining())
+            {
+                Fail(StreamContext::Status::TRUNCATED, "Truncated presence bitmap!");
+            }
+
+            return;
+        }
+
+        std::ranges::copy(mStream->Read(presence.size()), presence.begin());
+
+        size_t index{};
+        (
+            [&] {
+                if constexpr (is_optional_v<Types>)
+                {
+                    if (!(presence[index / 8] >> index % 8 & 1))
+                    {
+                        aObjects.reset();
+                    }
+                    else
+                    {
+                        if (!aObjects)
+                        {
+                            aObjects.emplace();
+                        }
+
+                        Read(*aObjects);
+                    }
+
+                    index++;
+                }
+                else
+                {
+                    Read(aObjects);
+                }
+            }(),
+            ...);
+    }
+
+    // applies the fields written by StreamWriter::WriteDelta to aObject, that must be like the baseline they were
+    // compared with, the other fields are left untouched
+    template <typename Type> constexpr void ReadDelta(Type &aObject)
+    {
+        Begin();
+
+        auto fields = Reflector::TieFields(aObject);
+        constexpr auto count = std::tuple_size_v<decltype(fields)>;
+
+        std::array<uint8_t, (count + 7) / 8> changed{};
+        if (!mStream->CanRead(changed.size()))
+        {
+            Fail(StreamContext::Status::TRUNCATED, "Truncated delta bitmap!");
+            return;
+        }
+
+        std::ranges::copy(mStream->Read(changed.size()), changed.begin());
+
+        [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+            ((changed[vIndexes / 8] >> vIndexes % 8 & 1 ? (void)ReadDeltaObject(std::get<vIndexes>(fields)) : void()),
+             ...);
+        }(std::make_index_sequence<count>{});
+    }
+
+    // reads an object written by StreamWriter::WriteArray, at compile time too
+    template <typename Type, size_t vSize>
+    [[nodiscard]] static constexpr Type ReadArray(const std::array<uint8_t, vSize> &aBytes)
+    {
+        Stream stream(aBytes);
+
+        Type object{};
+        StreamReader(stream).ReadAll(object);
+
+        return object;
+    }
+
+    constexpr void ReadAll()
+    {
+    }
+
+    // a range is written as its count followed by its elements, so they can be decoded one by one without building
+    // the range itself (reads any range whose elements are of type Type)
+    template <typename Type, typename Function>
+        requires std::invocable<Function, Type &&>
+    constexpr decltype(auto) ReadEach(Function &&aFunction)
+    {
+        Begin();
+
+        const auto count = ReadCount();
+        if (!CanReadCount(count, SizeFinder::FindMinSize<Type>()) ||
+            (count && !Align(SizeFinder::FindAlignment<Type>())))
+        {
+            return *this;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            Type object{};
+            Read(object);
+            std::invoke(aFunction, std::move(object));
+        }
+
+        return *this;
+    }
+
+    template <typename Type, std::output_iterator<Type> Iterator>
+        requires(!std::invocable<Iterator, Type &&>)
+    constexpr Iterator ReadEach(Iterator aIterator)
+    {
+        ReadEach<Type>([&](Type &&aObject) { *aIterator++ = std::move(aObject); });
+        return aIterator;
+    }
+
+    template <typename FunctionSeek>
+    constexpr decltype(auto) Peek(FunctionSeek &&aFunctionSeek, const Size::size_max aOffset = 0)
+    {
+        mStream->Peek(std::forward<FunctionSeek>(aFunctionSeek), aOffset);
+        return *this;
+    }
+
+    constexpr StreamReader &operator=(const StreamReader &aStreamReader) noexcept
+    {
+        mStream = aStreamReader.mStream;
+        return *this;
+    }
+
+    constexpr StreamReader &operator=(StreamReader &&aStreamReader) noexcept
+    {
+        mStream = aStreamReader.mStream;
+        return *this;
+    }
+
+  private:
+    Stream *mStream{};
+
+    template <typename Type> constexpr decltype(auto) Read(Type &aObject)
+    {
+        if constexpr (is_optional_v<Type>)
+        {
+            return ReadNested([&] { ReadOptional(aObject); });
+        }
+        else if constexpr (is_variant_v<Type>)
+        {
+            return ReadVariant(aObject);
+        }
+        else if constexpr (is_tuple_v<Type>)
+        {
+            std::apply([&](auto &&...aArgs) { ReadAll(aArgs...); }, aObject);
+            return *this;
+        }
+        else if constexpr (is_pair_v<Type>)
+        {
+            // we remove the constness of map's pair's key so we can use the already implemented Read branches
+            auto &first = const_cast<std::remove_const_t<typename Type::first_type> &>(aObject.first);
+            return ReadAll(first, aObject.second);
+        }
+        else if constexpr (is_shaped<Type>)
+        {
+            return ReadShaped(aObject);
+        }
+        else if constexpr (is_columnar_v<Type>)
+        {
+            return ReadColumnar(aObject);
+        }
+        else if constexpr (is_fixed_array<Type>)
+        {
+            return ReadFixedArray(aObject);
+        }
+        else if constexpr (is_span_v<Type>)
+        {
+            return ReadSpan(aObject);
+        }
+        else if constexpr (has_streamable_fields<Type>)
+        {
+            // the fields are read one after another, without a size in bytes like streamables
+            return ReadNested(
+                [&] { std::apply([&](auto &&...aArgs) { ReadAll(aArgs...); }, StreamableFields(aObject)); });
+        }
+        else if constexpr (is_reflectable<Type>)
+        {
+            return ReadNested(
+                [&] { std::apply([&](auto &&...aArgs) { ReadAll(aArgs...); }, Reflector::Tie(aObject)); });
+        }
+        else if constexpr (std::ranges::range<Type>)
+        {
+            // the ranges of objects of known size can't hold themselves
+            if constexpr (is_known_size<range_value_t<Type>>)
+            {
+                return ReadRange(aObject);
+            }
+            else
+            {
+                return ReadNested([&] { ReadRange(aObject); });
+            }
+        }
+        else if constexpr (std::derived_from<Type, IStreamable>)
+        {
+            return ReadStreamable(aObject);
+        }
+        else if constexpr (is_any_pointer<Type>)
+        {
+            return ReadNested([&] { ReadPointer(aObject); });
+        }
+        else if constexpr (is_standard_layout_no_pointer<Type>)
+        {
+            return ReadObjectOfKnownSize(aObject);
+        }
+        else
+        {
+            static_assert(always_false<Type>, "Type is not accepted!");
+        }
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadOptional(Type &aOpt)
+    {
+        static_assert(is_optional_v<Type>, "Type is not an optional!");
+
+        if (!ReadCount())
+        {
+            aOpt.reset();
+            return *this;
+        }
+
+        // read into the existing value so it keeps its capacity
+        if (!aOpt.has_value())
+        {
+            aOpt.emplace();
+        }
+
+        return Read(*aOpt);
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadVariant(Type &aVariant)
+    {
+        static_assert(is_variant_v<Type>, "Type is not a variant!");
+
+        return ReadVariantIndex(aVariant, ReadCount(), std::make_index_sequence<std::variant_size_v<Type>>{});
+    }
+
+    template <typename Type, size_t... vIndexes>
+    constexpr decltype(auto) ReadVariantIndex(Type &aVariant, const Size::size_max aIndex,
+                                              const std::index_sequence<vIndexes...>)
+    {
+        constexpr std::array<void (StreamReader::*)(Type &), sizeof...(vIndexes)> reads{
+            &StreamReader::ReadVariantAs<Type, vIndexes>...};
+        if (aIndex >= reads.size())
+        {
+            Fail(StreamContext::Status::INVALID_INDEX, "Out of bounds variant index!");
+            return *this;
+        }
+
+        (this->*reads[aIndex])(aVariant);
+        return *this;
+    }
+
+    template <typename Type, size_t vIndex> constexpr void ReadVariantAs(Type &aVariant)
+    {
+        // the alternative is constructed only if it's not the one we already hold
+        if (aVariant.index() != vIndex)
+        {
+            aVariant.template emplace<vIndex>();
+        }
+
+        Read(std::get<vIndex>(aVariant));
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadPointer(Type &aPointer)
+    {
+        static_assert(is_any_pointer<Type>, "Type is not a smart/raw pointer!");
+
+        // shared objects are read only once, later they are read as a reference to the first one
+        if constexpr (is_shared_ptr_v<Type>)
+        {
+            const auto context = mStream->GetContext();
+            if (context && context->Has(StreamContext::Option::IDENTITY))
+            {
+                return ReadShared(aPointer, context->mIdentitiesRead);
+            }
+        }
+
+        return ReadPointerObject(aPointer);
+    }
+
+    template <typename Type>
+    constexpr decltype(auto) ReadShared(Type &aPointer,
+                                        std::vector<std::pair<std::shared_ptr<void>, std::type_index>> &aIdentities)
+    {
+        static_assert(is_shared_ptr_v<Type>, "Type is not a shared pointer!");
+
+        if (const auto identity = ReadCount())
+        {
+            if (identity > aIdentities.size())
+            {
+                Fail(StreamContext::Status::INVALID_INDEX, "Out of bounds shared pointer identity!");
+                return *this;
+            }
+
+            // the writer references only objects written through pointers of the same type
+            const auto &[object, type] = aIdentities[identity - 1];
+            if (type != typeid(typename Type::element_type))
+            {
+                Fail(StreamContext::Status::INVALID_INDEX, "Shared pointer identity of another type!");
+                return *this;
+            }
+
+            aPointer = std::static_pointer_cast<typename Type::element_type>(object);
+            return *this;
+        }
+
+        // the identity is taken before reading the object to match the order of the writer
+        const auto identity = aIdentities.size();
+        aIdentities.emplace_back(nullptr, typeid(typename Type::element_type));
+
+        ReadPointerObject(aPointer);
+        aIdentities[identity].first = aPointer;
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadPointerObject(Type &aPointer)
+    {
+        // we treat pointers to streamable in a special way, they allocate the derived class themselves
+        if constexpr (is_derived_from_pointer<Type, IStreamable>)
+        {
+            return ReadStreamablePtr(aPointer);
+        }
+        else
+        {
+            New<Type, typename std::pointer_traits<Type>::element_type>(aPointer);
+            return Read(*aPointer);
+        }
+    }
+
+    template <typename Type, bool vPolymorphic = false> constexpr decltype(auto) ReadStreamable(Type &aStreamable)
+    {
+        static_assert(std::derived_from<Type, IStreamable>, "Type is not a streamable!");
+
+        const auto size = ReadCount(); // read streamable size in bytes
+        if (!Align(ALIGNMENT_MAX) || !CanReadCount(size, sizeof(uint8_t)))
+        {
+            return *this;
+        }
+
+        return ReadNested([&] {
+            // nested streamables share our context and are not deserialized from scratch
+            aStreamable.Invalidate();
+            aStreamable.Swap(mStream->ReadStream(size));
+
+            // a pointed object or one seen through a reference to its base needs the virtual call
+            if constexpr (vPolymorphic || std::is_abstract_v<Type>)
+            {
+                aStreamable.FromStream();
+            }
+            else if (std::is_final_v<Type> || typeid(aStreamable) == typeid(Type))
+            {
+                aStreamable.Type::FromStream();
+            }
+            else
+            {
+                aStreamable.FromStream();
+            }
+        });
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadStreamablePtr(Type &aStreamablePtr)
+    {
+        static_assert(is_derived_from_pointer<Type, IStreamable>, "Type is not a streamable smart/raw pointer!");
+
+        using TypeNoPtr = std::conditional_t<std::is_pointer_v<Type>, std::remove_pointer_t<Type>,
+                                             typename std::pointer_traits<Type>::element_type>;
+
+        // registered derived classes are prefixed by their index so we can allocate and read them in a single pass
+        if constexpr (has_streamable_derived<TypeNoPtr>)
+        {
+            using TypeDerived = std::type_identity<typename TypeNoPtr::StreamableDerived>;
+            NewDerived(aStreamablePtr, ReadCount(), TypeDerived{});
+        }
+        else
+        {
+            // we cannot use the has_method_find_derived_streamable concept because we must use the context of the
+            // StreamReader that is a friend of streamables
+            static_assert(
+                requires(StreamReader &aStreamReader) {
+                    {
+                        TypeNoPtr::FindDerivedStreamable(aStreamReader)
+                    } -> std::convertible_to<IStreamable *>;
+                }, "Type doesn't have a public/protected method 'static "
+                   "IStreamable* FindDerivedStreamable(StreamReader &)' !");
+
+            Peek([&](auto) {
+                const auto size = ReadCount(); // read streamable size in bytes
+                if (!Align(ALIGNMENT_MAX) || !CanReadCount(size, sizeof(uint8_t)))
+                {
+                    return;
+                }
+
+                // the factory reads with our context, so its errors follow the limits and the throwing mode too
+                auto stream = mStream->ReadStream(size);
+                StreamReader streamReader(stream);
+
+                // TODO: we let the user read n objects after wich we read again... fix it
+                if constexpr (is_smart_pointer<Type>)
+                {
+                    aStreamablePtr.reset(static_cast<TypeNoPtr *>(TypeNoPtr::FindDerivedStreamable(streamReader)));
+                }
+                else
+                {
+                    aStreamablePtr = dynamic_cast<TypeNoPtr *>(TypeNoPtr::FindDerivedStreamable(streamReader));
+                }
+            });
+
+            // the factory failed without throwing, nothing after it can be read right
+            if (const auto context = mStream->GetContext(); context && context->mStatus != StreamContext::Status::OK)
+            {
+                mStream->Skip();
+                return *this;
+            }
+        }
+
+        // the derived streamable is not known, it's skipped so the objects after it are read from the right offset
+        if (!aStreamablePtr)
+        {
+            const auto size = ReadCount();
+            if (Align(ALIGNMENT_MAX) && CanReadCount(size, sizeof(uint8_t)))
+            {
+                [[maybe_unused]] const auto view = mStream->Read(size);
+            }
+
+            return *this;
+        }
+
+        return ReadStreamable<TypeNoPtr, true>(*aStreamablePtr);
+    }
+
+    template <typename Type, typename... Types>
+    constexpr decltype(auto) NewDerived(Type &aPointer, const Size::size_max aIndex,
+                                        const std::type_identity<std::tuple<Types...>>)
+    {
+        static_assert(sizeof...(Types), "There are no registered derived streamables!");
+
+        using TypeNoPtr = typename std::pointer_traits<Type>::element_type;
+
+        constexpr std::array<void (StreamReader::*)(Type &), sizeof...(Types)> news{
+            &StreamReader::NewDerivedAs<Type, TypeNoPtr, Types>...};
+        if (aIndex >= news.size())
+        {
+            Fail(StreamContext::Status::INVALID_INDEX, "Out of bounds derived streamable index!");
+            return *this;
+        }
+
+        (this->*news[aIndex])(aPointer);
+        return *this;
+    }
+
+    template <typename Type, typename TypeNoPtr, typename TypeDerived> constexpr void NewDerivedAs(Type &aPointer)
+    {
+        // derived classes inherit the registered classes of their bases, not all of them are derived from them
+        if constexpr (std::derived_from<TypeDerived, TypeNoPtr>)
+        {
+            New<Type, TypeDerived>(aPointer);
+        }
+        else
+        {
+            Fail(StreamContext::Status::INVALID_INDEX, "Derived streamable index of a class that is not derived!");
+        }
+    }
+
+    template <typename Type, typename TypeObject> constexpr decltype(auto) New(Type &aPointer)
+    {
+        static_assert(is_any_pointer<Type>, "Type is not a smart/raw pointer!");
+
+        if (!CanAllocate(1, sizeof(TypeObject)))
+        {
+            return *this;
+        }
+
+        const auto context = mStream->GetContext();
+        const auto memoryResource = context ? context->GetMemoryResource() : nullptr;
+
+        // raw pointers are deleted by their owner, so they never come from the memory resource
+        if (!memoryResource || std::is_pointer_v<Type>)
+        {
+            if constexpr (is_shared_ptr_v<Type>)
+            {
+                aPointer = std::make_shared<TypeObject>();
+            }
+            else if constexpr (is_unique_ptr_v<Type>)
+            {
+                aPointer = Type(new TypeObject);
+            }
+            else
+            {
+                aPointer = new TypeObject;
+            }
+
+            return *this;
+        }
+
+        std::pmr::polymorphic_allocator<TypeObject> allocator(memoryResource);
+        if constexpr (is_shared_ptr_v<Type>)
+        {
+            // the control block is allocated together with the object
+            aPointer = std::allocate_shared<TypeObject>(allocator);
+        }
+        else if constexpr (is_unique_ptr_v<Type>)
+        {
+            using TypeDeleter = typename Type::deleter_type;
+
+            // only our deleter knows how to give the object back to the memory resource
+            if constexpr (std::is_same_v<TypeDeleter, Deleter<typename Type::element_type>>)
+            {
+                const TypeDeleter deleter(memoryResource, sizeof(TypeObject), alignof(TypeObject));
+                aPointer = Type(allocator.template new_object<TypeObject>(), deleter);
+            }
+            else
+            {
+                aPointer = Type(new TypeObject);
+            }
+        }
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadFixedArray(Type &aRange)
+    {
+        static_assert(is_fixed_array<Type>, "Type is not an array!");
+
+        if constexpr (is_known_size<Type>)
+        {
+            ReadObjectOfKnownSize(aRange);
+        }
+        else
+        {
+            for (auto &object : aRange)
+            {
+                Read(object);
+            }
+        }
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadShaped(Type &aShaped)
+    {
+        static_assert(is_shaped<Type>, "Type is not a dense or rectangular array!");
+
+        typename Type::shape_type shape{};
+        std::ranges::generate(shape, [&] { return ReadCount(); });
+
+        if (!Align(SizeFinder::FindAlignment<typename Type::value_type>()))
+        {
+            return *this;
+        }
+
+        // the product of the extents can't overflow, the rows of a rectangular range are allocated even when they are
+        // empty so they are counted apart
+        constexpr auto max = std::numeric_limits<Size::size_max>::max();
+        Size::size_max count{1}, countRows{};
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            if ((shape[i] && count > max / shape[i]) || (i + 1 < shape.size() && countRows > max - count * shape[i]))
+            {
+                Fail(StreamContext::Status::INVALID_COUNT, "Shape out of the stream bounds!");
+                return *this;
+            }
+
+            count *= shape[i];
+            countRows += i + 1 < shape.size() ? count : 0;
+        }
+
+        if (!CanReadCount(count, sizeof(typename Type::value_type)) ||
+            !CanAllocate(count, sizeof(typename Type::value_type)))
+        {
+            return *this;
+        }
+
+        if constexpr (is_rectangular_v<Type>)
+        {
+            if (!CanAllocate(countRows, sizeof(range_value_t<typename Type::range_type>)))
+            {
+                return *this;
+            }
+        }
+
+        aShaped.Reshape(shape);
+
+        // the elements are read in a single block in a dense array and in a block per row in a rectangular range
+        const auto ReadElements = [&](const auto aElements) {
+            if (aElements.empty())
+            {
+                return;
+            }
+
+            std::memcpy(aElements.data(), mStream->Read(aElements.size_bytes()).data(), aElements.size_bytes());
+        };
+
+        if constexpr (is_dense_v<Type>)
+        {
+            ReadElements(aShaped.GetElements());
+        }
+        else
+        {
+            aShaped.ForEachRow([&](auto &aRow) { ReadElements(std::span(aRow)); });
+        }
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadColumnar(Type &aColumnar)
+    {
+        static_assert(is_columnar_v<Type>, "Type is not a columnar range!");
+
+        const auto count = ReadCount();
+        if (!CanReadCount(count, Type::FindMinSize()) || !CanAllocate(count, Type::FindRecordSize()))
+        {
+            return *this;
+        }
+
+        aColumnar.Resize(count);
+
+        aColumnar.ForEachColumn([&](auto &&aColumn) {
+            using TypeColumn = std::remove_cvref_t<decltype(aColumn)>;
+
+            if (!Align(SizeFinder::FindRangeAlignment<TypeColumn>()))
+            {
+                return;
+            }
+
+            if constexpr (std::ranges::contiguous_range<TypeColumn> && is_known_size<range_value_t<TypeColumn>>)
+            {
+                // the columns before may have been bigger than their minimum
+                const auto column = std::span(aColumn);
+                if (column.empty() || !CanReadCount(column.size(), sizeof(range_value_t<TypeColumn>)))
+                {
+                    return;
+                }
+
+                std::memcpy(column.data(), mStream->Read(column.size_bytes()).data(), column.size_bytes());
+            }
+            else
+            {
+                for (auto &&object : aColumn)
+                {
+                    Read(object);
+                }
+            }
+        });
+
+        return *this;
+    }
 
-    [[nodiscard]] static inline auto MakeSize(const span aSize) noexcept
+    // the span points to the elements in the stream, they must be aligned, so the stream must outlive it
+    template <typename Type> constexpr decltype(auto) ReadSpan(Type &aSpan)
     {
-        uint8_t SIZE_AS_CHARS[SIZE_MAX_IN_BYTES]{};
-        auto &SIZE = *reinterpret_cast<size_max *>(SIZE_AS_CHARS);
+        using TypeValueType = typename Type::value_type;
 
-        size_max requiredBytes{};
-        if constexpr (SIZE_MAX_IN_BYTES == 4)
+        static_assert(Type::extent == std::dynamic_extent && std::is_const_v<typename Type::element_type> &&
+                          is_known_size<TypeValueType>,
+                      "Only spans of dynamic extent of const objects of known size can be read!");
+
+        aSpan = {};
+
+        const auto count = ReadCount();
+        if (!count || !Align(SizeFinder::FindAlignment<TypeValueType>()) ||
+            !CanReadCount(count, sizeof(TypeValueType)))
         {
-            requiredBytes = static_cast<size_max>(aSize.front() >> 6);
+            return *this;
         }
-        else
+
+        if (reinterpret_cast<std::uintptr_t>(mStream->Position()) % alignof(TypeValueType))
         {
-            requiredBytes = static_cast<size_max>(aSize.front() >> 5);
+            Fail(StreamContext::Status::MISALIGNED, "The elements of the span are not aligned!");
+            return *this;
         }
 
-        auto SIZE_AS_CHARS_START = SIZE_AS_CHARS + (SIZE_MAX_IN_BYTES - requiredBytes);
-        // copy only the resizeable size
-        std::memcpy(SIZE_AS_CHARS_START, aSize.data(), requiredBytes);
+        const auto elementsPtr = mStream->Read(count * sizeof(TypeValueType)).data();
+        aSpan = Type(reinterpret_cast<const TypeValueType *>(elementsPtr), count);
 
-        // clear the required bytes
-        if constexpr (SIZE_MAX_IN_BYTES == 4)
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) ReadRange(Type &aRange)
+    {
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        const auto count = ReadCount();
+        if (!CanReadRange<Type>(count) || (count && !Align(SizeFinder::FindRangeAlignment<Type>())))
         {
-            *SIZE_AS_CHARS_START &= 0b00111111;
+            return *this;
+        }
+
+        if constexpr (SizeFinder::FindRangeRank<Type>() > 1)
+        {
+            ReadRangeElements(aRange, count, [&](auto &aObject) { ReadRange(aObject); });
         }
         else
         {
-            *SIZE_AS_CHARS_START &= 0b00011111;
+            ReadRangeRank1(aRange, count);
         }
 
-        return ToBigEndian(SIZE);
+        return *this;
     }
 
-  private:
-    static inline constexpr auto SIZE_MAX_IN_BYTES = sizeof(size_max);
-
-    [[nodiscard]] static constexpr size_max ToBigEndian(const size_max aSize) noexcept
+    template <typename Type, typename FunctionRead>
+    constexpr decltype(auto) ReadRangeElements(Type &aRange, const Size::size_max aCount, FunctionRead &&aFunctionRead)
     {
-        if constexpr (std::endian::native == std::endian::little)
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        using TypeValueType = typename Type::value_type;
+
+        // sequence containers are refilled in place, so the range and its elements keep their capacity
+        if constexpr (has_method_resize<Type>)
         {
-            return ByteSwap(aSize);
+            aRange.resize(aCount);
+
+            for (auto &object : aRange)
+            {
+                aFunctionRead(object);
+            }
         }
         else
         {
-            return aSize;
+            aRange.clear();
+            ReserveRange(aRange, aCount);
+
+            for (size_t i = 0; i < aCount; i++)
+            {
+                TypeValueType object{};
+                aFunctionRead(object);
+                InsertRange(aRange, std::move(object));
+            }
         }
+
+        return *this;
     }
-};
 
-class Stream
-{
-    friend class StreamReader;
+    template <typename Type> constexpr decltype(auto) ReadPath(Type &aRange, const Size::size_max aCount)
+    {
+        static_assert(is_path<Type>, "Type is not a path!");
 
-  public:
-    using vector = std::vector<uint8_t>;
-    using span = std::span<const uint8_t>;
-    using stream = std::variant<vector, span>;
+        using TypeStringType = typename Type::string_type;
 
-    constexpr Stream() noexcept : mStream(vector())
-    {
-    }
+        TypeStringType pathNative{};
+        ReadRangeStandardLayout(pathNative, aCount);
+        aRange.assign(pathNative);
 
-    constexpr Stream(const Stream &) noexcept
-    {
+        return *this;
     }
 
-    constexpr explicit Stream(const span aSpan) noexcept : mStream(aSpan)
+    template <typename Type> constexpr StreamReader &ReadRangeStandardLayout(Type &aRange, const Size::size_max aCount)
     {
+        static_assert(is_range_standard_layout<Type>, "Type is not a standard layout range!");
+
+        using TypeValueType = typename Type::value_type;
+
+        if (!aCount)
+        {
+            aRange.clear();
+            return *this;
+        }
+
+        if constexpr (is_wide_string<Type>)
+        {
+            aRange.assign(Converter::Decode<Type>(mStream->Read(aCount)));
+        }
+        else if constexpr (is_path<Type>)
+        {
+            ReadPath(aRange, aCount);
+        }
+        else if (std::is_constant_evaluated())
+        {
+            aRange.clear();
+            for (size_t i = 0; i < aCount; i++)
+            {
+                TypeValueType object{};
+                ReadObjectOfKnownSize(object);
+                aRange.push_back(object);
+            }
+        }
+        else
+        {
+            // the elements may not be aligned in the stream, so they are copied instead of dereferenced
+            const auto rangeView = mStream->Read(aCount * sizeof(TypeValueType));
+            aRange.resize(aCount);
+            std::memcpy(std::ranges::data(aRange), rangeView.data(), rangeView.size());
+        }
+
+        return *this;
     }
 
-    constexpr Stream(Stream &&aStream) noexcept
+    template <typename Type> constexpr decltype(auto) ReadRangeRank1(Type &aRange, const Size::size_max aCount)
     {
-        *this = std::move(aStream);
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        if constexpr (is_range_standard_layout<Type>)
+        {
+            ReadRangeStandardLayout(aRange, aCount);
+        }
+        else
+        {
+            ReadRangeElements(aRange, aCount, [&](auto &aObject) { Read(aObject); });
+        }
+
+        return *this;
     }
 
-    constexpr vector &&Release() noexcept
+    template <typename Type> constexpr decltype(auto) ReserveRange(Type &aRange, const Size::size_max aCount)
     {
-        return std::move(GetStream());
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        // clamp to the bytes left so a corrupted count can't make us reserve more than the stream could ever fill
+        if constexpr (has_method_reserve<Type>)
+        {
+            aRange.reserve(std::min(aCount, mStream->Remaining()));
+        }
+
+        return *this;
     }
 
-    template <typename FunctionSeek>
-    constexpr decltype(auto) Peek(FunctionSeek &&aFunctionSeek, const Size::size_max aOffset = 0)
+    template <typename Type, typename TypeValueType>
+    constexpr decltype(auto) InsertRange(Type &aRange, TypeValueType &&aObject)
     {
-        ThrowIfCantRead(aOffset);
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
 
-        const auto readIndex = mReadIndex;
-        mReadIndex += aOffset;
-        aFunctionSeek(readIndex);
-        mReadIndex = readIndex;
+        // ordered containers were written in order, so hinting the end makes every insertion amortized O(1)
+        if constexpr (has_method_emplace_hint<Type>)
+        {
+            aRange.emplace_hint(std::ranges::cend(aRange), std::forward<TypeValueType>(aObject));
+        }
+        else
+        {
+            aRange.insert(std::ranges::cend(aRange), std::forward<TypeValueType>(aObject));
+        }
 
         return *this;
     }
 
-    constexpr decltype(auto) Reserve(const Size::size_max aSize)
+    template <typename Type> constexpr decltype(auto) ReadTaggedObject(const Tag::Kind aKind, Type &aObject)
     {
-        GetStream().reserve(aSize);
+        // the type of the object changed, we can't read the old one
+        constexpr auto kind = Tag::FindKind<Type>();
+        if (aKind != kind)
+        {
+            return SkipTaggedObject(aKind);
+        }
+
+        if constexpr (kind == Tag::Kind::DELIMITED)
+        {
+            const auto size = ReadCount();
+            if (!Align(ALIGNMENT_MAX) || !CanReadCount(size, sizeof(uint8_t)))
+            {
+                return *this;
+            }
+
+            // the object can't read past its own bytes
+            auto stream = mStream->ReadStream(size);
+            StreamReader(stream).Read(aObject);
+        }
+        else
+        {
+            Read(aObject);
+        }
+
         return *this;
     }
 
-    [[nodiscard]] constexpr auto View() noexcept
+    constexpr decltype(auto) SkipTaggedObject(const Tag::Kind aKind)
     {
-        const auto spen = std::get_if<span>(&mStream);
-        return spen ? *spen : GetStream();
+        Size::size_max size{};
+        if (aKind == Tag::Kind::DELIMITED)
+        {
+            size = ReadCount();
+            if (!Align(ALIGNMENT_MAX))
+            {
+                return *this;
+            }
+        }
+        else if (aKind < Tag::Kind::DELIMITED)
+        {
+            size = Tag::FindFixedSize(aKind);
+        }
+        else
+        {
+            Fail(StreamContext::Status::INVALID_INDEX, "Unknown tagged object kind!");
+            return *this;
+        }
+
+        if (CanReadCount(size, sizeof(uint8_t)))
+        {
+            [[maybe_unused]] const auto view = mStream->Read(size);
+        }
+
+        return *this;
     }
 
-    [[nodiscard]] constexpr auto CanRead(const Size::size_max aSize) noexcept
+    template <typename Type, size_t... vIndexes>
+    [[nodiscard]] constexpr bool ReadKnownSizeRun(Type &aObjects, const std::index_sequence<vIndexes...>)
     {
-        const auto view = View();
-        return mReadIndex + aSize <= view.size();
+        constexpr auto sizes = std::array{sizeof(std::remove_cvref_t<std::tuple_element_t<vIndexes, Type>>)...};
+        constexpr auto size = (sizes[vIndexes] + ...);
+
+        if (!mStream->CanRead(size))
+        {
+            return false;
+        }
+
+        auto bytesPtr = mStream->Read(size).data();
+        ((std::memcpy(&std::get<vIndexes>(aObjects), bytesPtr, sizes[vIndexes]), bytesPtr += sizes[vIndexes]), ...);
+
+        return true;
     }
 
-    [[nodiscard]] constexpr auto Read(const Size::size_max aSize)
+    template <typename Type> constexpr decltype(auto) ReadObjectOfKnownSize(Type &aObject)
     {
-        ThrowIfCantRead(aSize);
+        static_assert(is_standard_layout_no_pointer<Type>, "Type is not an object of known size or it is a pointer!");
 
-        mReadIndex += aSize;
-        return span{View().data() + (mReadIndex - aSize), aSize};
+        // a missing object was not written by an older version, but a part of one is an error
+        if (!mStream->CanRead(sizeof(Type)))
+        {
+            if (mStream->Remaining())
+            {
+                Fail(StreamContext::Status::TRUNCATED, "Truncated object!");
+            }
+
+            return *this;
+        }
+
+        const auto view = mStream->Read(sizeof(Type));
+
+        // the bytes of an object can't be reinterpreted at compile time, but they can be copied
+        if constexpr (std::is_trivially_copyable_v<Type> && !std::is_array_v<Type>)
+        {
+            if (std::is_constant_evaluated())
+            {
+                std::array<uint8_t, sizeof(Type)> bytes{};
+                std::ranges::copy(view, bytes.begin());
+
+                aObject = std::bit_cast<Type>(bytes);
+                return *this;
+            }
+        }
+
+        // the object may not be aligned in the stream, so it's copied instead of dereferenced
+        std::memcpy(static_cast<void *>(&aObject), view.data(), sizeof(Type));
+
+        return *this;
     }
 
-    [[nodiscard]] constexpr auto Current()
+    constexpr Size::size_max ReadCount()
     {
-        ThrowIfCantRead(1);
-        return View()[mReadIndex];
+        if (!mStream->CanRead(1))
+        {
+            return 0;
+        }
+
+        const auto size = Size::FindRequiredBytes(mStream->Current());
+        if (!mStream->CanRead(size))
+        {
+            Fail(StreamContext::Status::TRUNCATED, "Truncated count!");
+            return 0;
+        }
+
+        return Size::MakeSize(mStream->Read(size));
     }
 
-    constexpr decltype(auto) Write(const span aSpan)
+    // skips the padding of aligned streams, the objects start at aAlignment from the start of the stream
+    constexpr bool Align(const size_t aAlignment)
     {
-        GetStream().insert(GetStream().end(), aSpan.data(), aSpan.data() + aSpan.size());
-        return *this;
+        const auto context = mStream->GetContext();
+        if (!context || !context->Has(StreamContext::Option::ALIGNED))
+        {
+            return true;
+        }
+
+        const auto offset = static_cast<size_t>(mStream->Position() - mStream->View().data());
+        const auto padding = (aAlignment - offset % aAlignment) % aAlignment;
+
+        // a missing object was not written by an older version, but a part of one is an error
+        if (!mStream->CanRead(padding))
+        {
+            if (mStream->Remaining())
+            {
+                Fail(StreamContext::Status::TRUNCATED, "Truncated padding!");
+            }
+
+            return false;
+        }
+
+        [[maybe_unused]] const auto view = mStream->Read(padding);
+        return true;
     }
 
-    constexpr Stream &operator=(const Stream &) noexcept
+    template <typename Type> constexpr decltype(auto) ReadDeltaObject(Type &aObject)
     {
-        return *this;
+        if constexpr (is_patchable<Type>)
+        {
+            // the elements after the ones of the baseline are all written, so they bound the count
+            const auto count = ReadCount();
+            const auto countChanged = ReadCount();
+            if (!CanReadCount(countChanged, sizeof(uint8_t) + SizeFinder::FindMinSize<range_value_t<Type>>()))
+            {
+                return *this;
+            }
+
+            if (count > std::ranges::size(aObject) + countChanged)
+            {
+                Fail(StreamContext::Status::INVALID_COUNT, "Delta count over the written elements!");
+                return *this;
+            }
+
+            if (!CanAllocate(count, sizeof(range_value_t<Type>)))
+            {
+                return *this;
+            }
+
+            aObject.resize(count);
+
+            for (size_t i = 0; i < countChanged; i++)
+            {
+                const auto index = ReadCount();
+                if (index >= count)
+                {
+                    Fail(StreamContext::Status::INVALID_INDEX, "Out of bounds delta element index!");
+                    return *this;
+                }
+
+                Read(aObject[index]);
+            }
+
+            return *this;
+        }
+        else
+        {
+            return Read(aObject);
+        }
     }
 
-    constexpr Stream &operator=(Stream &&aStream) noexcept
+    // the objects that can hold objects of their own type (through ranges, optionals, pointers, fields or streamables)
+    // are counted against the depth limit, so a hostile stream can't recurse without bound
+    template <typename Function> constexpr decltype(auto) ReadNested(Function &&aFunction)
     {
-        mStream = std::move(aStream.mStream);
-        mReadIndex = aStream.mReadIndex;
+        const auto context = mStream->GetContext();
+        if (!context)
+        {
+            aFunction();
+            return *this;
+        }
 
-        return *this;
-    }
+        if (context->mDepth++ == context->mLimits.depth)
+        {
+            context->mDepth--;
 
-    constexpr decltype(auto) Clear() noexcept
-    {
-        GetStream().clear();
+            Fail(StreamContext::Status::OVER_LIMIT, "Objects nested deeper than the limit!");
+            return *this;
+        }
+
+        try
+        {
+            aFunction();
+        }
+        catch (...)
+        {
+            context->mDepth--;
+            throw;
+        }
+
+        context->mDepth--;
         return *this;
     }
 
-  private:
-    stream mStream{};
-    Size::size_max mReadIndex{};
-
-    constexpr vector &GetStream() noexcept
+    // reading from the start of a stream that is not nested is a new deserialization, so the budget of the context
+    // is spent again (ex.: a context reused by many readers)
+    constexpr void Begin() noexcept
     {
-        // if crashed here --> it's read only (span)
-        return std::get<vector>(mStream);
+        const auto context = mStream->GetContext();
+        if (context && !context->mDepth && mStream->Position() == mStream->View().data())
+        {
+            context->mAllocated = 0;
+        }
     }
 
-    constexpr void ThrowIfCantRead(const Size::size_max aSize)
+    // a count of objects of at least aSize bytes each can't ask for more bytes than there are left
+    [[nodiscard]] constexpr bool CanReadCount(const Size::size_max aCount, const Size::size_max aSize)
     {
-        if (!CanRead(aSize))
+        if (!aSize || aCount <= mStream->Remaining() / aSize)
         {
-            throw std::out_of_range("Invalid Stream subscript!");
+            return true;
         }
+
+        Fail(StreamContext::Status::INVALID_COUNT, "Count out of the stream bounds!");
+        return false;
     }
-};
 
-class SizeFinder
-{
-  public:
-    template <typename Type> [[nodiscard]] static consteval Size::size_max FindRangeRank() noexcept
+    template <typename Type> [[nodiscard]] constexpr bool CanReadRange(const Size::size_max aCount)
     {
-        using TypeRaw = std::remove_cvref_t<Type>;
+        using TypeValueType = range_value_t<Type>;
 
-        if constexpr (std::ranges::range<TypeRaw>)
+        // the count of encoded strings is in bytes
+        if constexpr (is_wide_string<Type> || is_path<Type>)
         {
-            return 1 + FindRangeRank<typename TypeRaw::value_type>();
+            return CanReadCount(aCount, sizeof(uint8_t)) && CanAllocate(aCount, sizeof(uint8_t));
         }
         else
         {
-            return 0;
+            return CanReadCount(aCount, SizeFinder::FindMinSize<TypeValueType>()) &&
+                   CanAllocate(aCount, sizeof(TypeValueType));
         }
     }
 
-    template <std::ranges::range Range>
-    [[nodiscard]] static constexpr Size::size_max GetRangeCount(const Range &aRange) noexcept
+    // the objects allocated by the reader are counted against the limits of the context
+    [[nodiscard]] constexpr bool CanAllocate(const Size::size_max aCount, const Size::size_max aSize)
     {
-        using RangeRaw = std::remove_cvref_t<Range>;
-
-        if constexpr (has_method_size<RangeRaw>)
+        const auto context = mStream->GetContext();
+        if (!context)
         {
-            return std::ranges::size(aRange);
+            return true;
         }
-        else if constexpr (is_path<RangeRaw>)
+
+        const auto &limits = context->mLimits;
+        if (aCount > limits.count || context->mAllocated > limits.bytes ||
+            aCount > (limits.bytes - context->mAllocated) / aSize)
         {
-            return aRange.native().size();
+            Fail(StreamContext::Status::OVER_LIMIT, "Allocation over the limit!");
+            return false;
         }
-        else
+
+        context->mAllocated += aCount * aSize;
+        return true;
+    }
+
+    // throws the error or, when deserializing without exceptions, records it in the context and stops reading
+    constexpr void Fail(const StreamContext::Status aStatus, const char *aMessage)
+    {
+        const auto context = mStream->GetContext();
+        if (!context || context->mThrows)
         {
-            static_assert(always_false<RangeRaw>, "Tried to get the range count from an unknown object!");
+            throw std::out_of_range(aMessage);
         }
+
+        context->Fail(aStatus, mStream->Position());
+        mStream->Skip();
     }
 };
 
-class StreamReader
+class StreamWriter
 {
   public:
-    constexpr explicit StreamReader(Stream &aStream) noexcept : mStream(&aStream)
+    constexpr explicit StreamWriter(Stream &aStream) noexcept : mStream(&aStream)
     {
     }
 
-    constexpr StreamReader(const StreamReader &aStreamReader) noexcept : mStream(aStreamReader.mStream)
+    constexpr StreamWriter(const StreamWriter &aStreamWriter) noexcept : mStream(aStreamWriter.mStream)
     {
     }
 
-    constexpr StreamReader(StreamReader &&aStreamReader) noexcept
+    constexpr StreamWriter(StreamWriter &&aStreamWriter) noexcept
     {
-        *this = std::move(aStreamReader);
+        *this = std::move(aStreamWriter);
     }
 
-    template <typename Type, typename... Types> constexpr void ReadAll(Type &aObject, Types &...aObjects)
+    template <typename Type, typename... Types> constexpr void WriteAll(Type &&aObject, Types &&...aObjects)
     {
         using TypeRaw = std::remove_cvref_t<Type>;
 
-        Read<TypeRaw>(aObject);
+        // consecutive objects of known size are written with a single copy, that can't be made at compile time
+        if constexpr (constexpr auto run = SizeFinder::FindKnownSizeRun<Type, Types...>(); run > 1)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto objects = std::forward_as_tuple(aObject, aObjects...);
+
+                WriteKnownSizeRun(objects, std::make_index_sequence<run>{});
+                [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                    WriteAll(std::get<run + vIndexes>(objects)...);
+                }(std::make_index_sequence<sizeof...(Types) + 1 - run>{});
+
+                return;
+            }
+        }
+
+        Write<TypeRaw>(aObject);
 
         if constexpr (sizeof...(aObjects))
         {
-            ReadAll<Types...>(aObjects...);
+            WriteAll(std::forward<Types>(aObjects)...);
         }
     }
 
-    constexpr void ReadAll()
+    // every object is written with a key made of its id and its wire kind, so readers can skip the unknown ones
+    template <size_t vCount, typename... Types>
+    constexpr void WriteTagged(const std::array<Tag::id, vCount> &aIds, Types &...aObjects)
+    {
+        static_assert(vCount == sizeof...(Types), "There must be an id for every object!");
+
+        WriteCount(vCount);
+
+        size_t index{};
+        (WriteTaggedObject(aIds[index++], aObjects), ...);
+    }
+
+    // the optionals share a leading bitmap of their presence, instead of a count each, and only their values follow
+    template <typename... Types> constexpr void WriteSparse(Types &...aObjects)
     {
+        std::array<uint8_t, (SizeFinder::FindOptionalCount<Types...>() + 7) / 8> presence{};
+
+        size_t index{};
+        (
+            [&] {
+                if constexpr (is_optional_v<Types>)
+                {
+                    presence[index / 8] |= static_cast<uint8_t>(aObjects.has_value() << index % 8);
+                    index++;
+                }
+            }(),
+            ...);
+
+        mStream->Write(presence);
+
+        (
+            [&] {
+                if constexpr (is_optional_v<Types>)
+                {
+                    if (aObjects)
+                    {
+                        Write(*aObjects);
+                    }
+                }
+                else
+                {
+                    Write(aObjects);
+                }
+            }(),
+            ...);
     }
 
-    template <typename FunctionSeek>
-    constexpr decltype(auto) Peek(FunctionSeek &&aFunctionSeek, const Size::size_max aOffset = 0)
+    // writes a bitmap of the fields of aObject that differ from the fields of aBaseline followed by them, the patchable
+    // ranges as their count and the elements that differ, read by StreamReader::ReadDelta in an object like aBaseline
+    template <typename Type> constexpr void WriteDelta(Type &aObject, const Type &aBaseline)
     {
-        mStream->Peek(std::forward<FunctionSeek>(aFunctionSeek), aOffset);
-        return *this;
+        // the baseline is only compared, it's cast for its streamables that are tied and written by non const methods
+        auto fields = Reflector::TieFields(aObject);
+        auto fieldsBaseline = Reflector::TieFields(const_cast<Type &>(aBaseline));
+        constexpr auto count = std::tuple_size_v<decltype(fields)>;
+
+        std::array<uint8_t, (count + 7) / 8> changed{};
+        [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+            ((changed[vIndexes / 8] |= static_cast<uint8_t>(
+                  !IsEqual(std::get<vIndexes>(fields), std::get<vIndexes>(fieldsBaseline)) << vIndexes % 8)),
+             ...);
+        }(std::make_index_sequence<count>{});
+
+        mStream->Write(changed);
+
+        [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+            ((changed[vIndexes / 8] >> vIndexes % 8 & 1
+                  ? (void)WriteDeltaObject(std::get<vIndexes>(fields), std::get<vIndexes>(fieldsBaseline))
+                  : void()),
+             ...);
+        }(std::make_index_sequence<count>{});
     }
 
-    constexpr StreamReader &operator=(const StreamReader &aStreamReader) noexcept
+    // writes the object returned by vFunction at compile time, the size of the array is found by writing it twice
+    template <auto vFunction> [[nodiscard]] static consteval auto WriteArray()
     {
-        mStream = aStreamReader.mStream;
+        constexpr auto size = [] {
+            Stream stream;
+            StreamWriter(stream).WriteAll(vFunction());
+
+            return stream.View().size();
+        }();
+
+        Stream stream;
+        StreamWriter(stream).WriteAll(vFunction());
+
+        std::array<uint8_t, size> bytes{};
+        std::ranges::copy(stream.View(), bytes.begin());
+
+        return bytes;
+    }
+
+    constexpr void WriteAll()
+    {
+    }
+
+    constexpr StreamWriter &operator=(const StreamWriter &aStreamWriter) noexcept
+    {
+        mStream = aStreamWriter.mStream;
         return *this;
     }
 
-    constexpr StreamReader &operator=(StreamReader &&aStreamReader) noexcept
+    constexpr StreamWriter &operator=(StreamWriter &&aStreamWriter) noexcept
     {
-        mStream = aStreamReader.mStream;
+        mStream = aStreamWriter.mStream;
         return *this;
     }
 
   private:
     Stream *mStream{};
 
-    template <typename Type> constexpr decltype(auto) Read(Type &aObject)
+    template <typename Type> constexpr decltype(auto) WriteTaggedObject(const Tag::id aId, Type &aObject)
     {
-        if constexpr (is_optional_v<Type>)
+        constexpr auto kind = Tag::FindKind<Type>();
+        WriteCount(Tag::MakeKey(aId, kind));
+
+        if constexpr (kind == Tag::Kind::DELIMITED)
         {
-            return ReadOptional(aObject);
+            // we find the size in bytes after writing the object, in aligned streams the object is written on its own
+            // so it starts aligned like a nested stream, inserting the size would move it
+            if (IsAligned())
+            {
+                Stream stream(*mStream->GetContext());
+                StreamWriter(stream).Write(aObject);
+
+                const auto streamView = stream.View();
+                WriteCount(streamView.size());
+                Align(ALIGNMENT_MAX);
+                mStream->Write(streamView);
+            }
+            else
+            {
+                const auto offset = mStream->View().size();
+                Write(aObject);
+                mStream->Insert(offset, Size::MakeSize(mStream->View().size() - offset));
+            }
         }
-        else if constexpr (is_variant_v<Type>)
+        else
         {
-            return ReadVariant(aObject);
+            Write(aObject);
         }
-        else if constexpr (is_tuple_v<Type>)
+
+        return *this;
+    }
+
+    template <typename Type, size_t... vIndexes>
+    constexpr decltype(auto) WriteKnownSizeRun(Type &aObjects, const std::index_sequence<vIndexes...>)
+    {
+        constexpr auto sizes = std::array{sizeof(std::remove_cvref_t<std::tuple_element_t<vIndexes, Type>>)...};
+
+        // the objects are copied straight into the stream, a run of big arrays would not fit on the stack
+        const auto bytes = mStream->Extend((sizes[vIndexes] + ...));
+        auto bytesPtr = bytes;
+        ((std::memcpy(bytesPtr, &std::get<vIndexes>(aObjects), sizes[vIndexes]), bytesPtr += sizes[vIndexes]), ...);
+
+        if (IsCanonical())
         {
-            std::apply([&](auto &&...aArgs) { ReadAll(aArgs...); }, aObject);
-            return *this;
+            bytesPtr = bytes;
+            ((CopyCanonical(std::get<vIndexes>(aObjects), bytesPtr), bytesPtr += sizes[vIndexes]), ...);
         }
-        else if constexpr (is_pair_v<Type>)
+
+        return *this;
+    }
+
+    template <typename Type> constexpr decltype(auto) WriteObjectOfKnownSize(Type &aObject)
+    {
+        static_assert(is_standard_layout_no_pointer<Type>, "Type is not an object of known size or it is a pointer!");
+
+        // the bytes of an object can't be reinterpreted at compile time, but they can be copied
+        if constexpr (std::is_trivially_copyable_v<Type>)
         {
-            // we remove the constness of map's pair's key so we can use the already implemented Read branches
-            auto &first = const_cast<std::remove_const_t<typename Type::first_type> &>(aObject.first);
-            return ReadAll(first, aObject.second);
+            if (std::is_constant_evaluated())
+            {
+                mStream->Write(std::bit_cast<std::array<uint8_t, sizeof(Type)>>(aObject));
+                return *this;
+            }
         }
-        else if constexpr (std::ranges::range<Type>)
+
+        return WriteBlock(&aObject, 1);
+    }
+
+    // writes the bytes of the objects, in canonical streams their floating points are normalized and padding zeroed
+    template <typename Type> constexpr decltype(auto) WriteBlock(const Type *aObjects, const size_t aCount)
+    {
+        if constexpr (!std::has_unique_object_representations_v<Type>)
         {
-            aObject = std::move(ReadRange<Type>());
-            return *this;
+            if (IsCanonical())
+            {
+                auto bytes = mStream->Extend(aCount * sizeof(Type));
+                for (size_t i = 0; i < aCount; i++, bytes += sizeof(Type))
+                {
+                    CopyCanonical(aObjects[i], bytes);
+                }
+
+                return *this;
+            }
         }
-        else if constexpr (std::derived_from<Type, IStreamable>)
+
+        mStream->Write({reinterpret_cast<const uint8_t *>(aObjects), aCount * sizeof(Type)});
+        return *this;
+    }
+
+    /*
+        Copies the bytes of the object so equal objects have equal bytes: -0 is copied as 0, every NaN as the quiet
+        one and the padding of aggregates as 0, the other classes (and aggregates with C arrays) must not have padding
+        or floating points
+    */
+    template <typename Type> static constexpr void CopyCanonical(const Type &aObject, uint8_t *aBytes)
+    {
+        if constexpr (std::has_unique_object_representations_v<Type>)
         {
-            return ReadStreamable(aObject);
+            std::memcpy(aBytes, &aObject, sizeof(Type));
         }
-        else if constexpr (is_any_pointer<Type>)
+        else if constexpr (std::is_floating_point_v<Type>)
         {
-            return ReadPointer(aObject);
+            auto object = aObject;
+            if (std::isnan(object))
+            {
+                object = std::numeric_limits<Type>::quiet_NaN();
+            }
+            else if (object == Type{})
+            {
+                object = Type{};
+            }
+
+            std::memcpy(aBytes, &object, sizeof(Type));
         }
-        else if constexpr (is_standard_layout_no_pointer<Type>)
+        else if constexpr (is_fixed_array<Type>)
         {
-            return ReadObjectOfKnownSize(aObject);
+            for (auto &object : aObject)
+            {
+                CopyCanonical(object, aBytes);
+                aBytes += sizeof(object);
+            }
+        }
+        else if constexpr (is_bindable<Type> && detail::find_field_count<Type>() <= REFLECTABLE_FIELDS_MAX)
+        {
+            std::memset(aBytes, 0, sizeof(Type));
+            std::apply(
+                [&](auto &...aFields) {
+                    const auto objectPtr = reinterpret_cast<const uint8_t *>(&aObject);
+                    (CopyCanonical(aFields, aBytes + (reinterpret_cast<const uint8_t *>(&aFields) - objectPtr)), ...);
+                },
+                Reflector::Tie(aObject));
         }
         else
         {
-            static_assert(always_false<Type>, "Type is not accepted!");
+            throw std::invalid_argument("The fields of the object can't be found to be written canonically!");
         }
     }
 
-    template <typename Type> constexpr decltype(auto) ReadOptional(Type &aOpt)
+    template <typename Type> constexpr decltype(auto) WriteDeltaObject(Type &aObject, Type &aBaseline)
     {
-        static_assert(is_optional_v<Type>, "Type is not an optional!");
+        if constexpr (is_patchable<Type>)
+        {
+            // the elements after the ones of the baseline are new, so they are all written
+            const auto count = std::ranges::size(aObject);
+            const auto countBaseline = std::ranges::size(aBaseline);
 
-        using TypeValueType = typename Type::value_type;
+            std::vector<size_t> indexes;
+            for (size_t i = 0; i < count; i++)
+            {
+                if (i >= countBaseline || !IsEqual(aObject[i], aBaseline[i]))
+                {
+                    indexes.push_back(i);
+                }
+            }
+
+            WriteCount(count);
+            WriteCount(indexes.size());
+            for (const auto index : indexes)
+            {
+                WriteCount(index);
+                Write(aObject[index]);
+            }
 
-        if (ReadCount())
+            return *this;
+        }
+        else
         {
-            TypeValueType obj{};
-            Read(obj);
-            aOpt = std::move(obj);
+            return Write(aObject);
         }
-
-        return *this;
     }
 
-    template <typename Type> constexpr decltype(auto) ReadVariant(Type &aVariant)
+    // the objects are equal when the reader would get the same from them, so they are compared by their bytes or by
+    // their encoding (the pointers by their pointees and not by their addresses)
+    template <typename Type> [[nodiscard]] static constexpr bool IsEqual(Type &aObject1, Type &aObject2)
     {
-        static_assert(is_variant_v<Type>, "Type is not a variant!");
+        if (!std::is_constant_evaluated())
+        {
+            if constexpr (is_known_size<Type>)
+            {
+                return IsEqualBytes(aObject1, aObject2);
+            }
+            else if constexpr (is_range_standard_layout<Type> && !is_path<Type>)
+            {
+                using TypeValueType = range_value_t<Type>;
+                if constexpr (std::has_unique_object_representations_v<TypeValueType>)
+                {
+                    const auto size = std::ranges::size(aObject1) * sizeof(TypeValueType);
+                    return std::ranges::size(aObject1) == std::ranges::size(aObject2) &&
+                           (!size || !std::memcmp(std::ranges::data(aObject1), std::ranges::data(aObject2), size));
+                }
+                else
+                {
+                    return std::ranges::equal(aObject1, aObject2, [](auto &aElement1, auto &aElement2) {
+                        return IsEqualBytes(aElement1, aElement2);
+                    });
+                }
+            }
+        }
 
-        aVariant = variant_from_index<Type>(ReadCount());
-        std::visit([&](auto &&aArg) { Read(aArg); }, aVariant);
+        Stream stream1, stream2;
+        StreamWriter(stream1).Write(aObject1);
+        StreamWriter(stream2).Write(aObject2);
 
-        return *this;
+        return std::ranges::equal(stream1.View(), stream2.View());
     }
 
-    template <typename Type> constexpr decltype(auto) ReadPointer(Type &aPointer)
+    // the padding of aggregates is skipped, the other classes are compared with theirs so they may differ when equal
+    template <typename Type> [[nodiscard]] static bool IsEqualBytes(const Type &aObject1, const Type &aObject2) noexcept
     {
-        static_assert(is_any_pointer<Type>, "Type is not a smart/raw pointer!");
-
-        if constexpr (is_unique_ptr_v<Type>)
+        if constexpr (std::has_unique_object_representations_v<Type> || std::is_floating_point_v<Type>)
         {
-            aPointer = std::make_unique<typename Type::element_type>();
+            return !std::memcmp(&aObject1, &aObject2, sizeof(Type));
         }
-        else if constexpr (is_shared_ptr_v<Type>)
+        else if constexpr (is_fixed_array<Type>)
         {
-            aPointer = std::make_shared<typename Type::element_type>();
+            return std::ranges::equal(aObject1, aObject2, [](auto &aElement1, auto &aElement2) {
+                return IsEqualBytes(aElement1, aElement2);
+            });
         }
-        else if constexpr (!is_derived_from_pointer<Type, IStreamable>)
+        else if constexpr (is_bindable<Type> && detail::find_field_count<Type>() <= REFLECTABLE_FIELDS_MAX)
         {
-            // raw pointers MUST be allocated only for non streamables
-            aPointer = new std::remove_pointer_t<Type>;
-        }
+            const auto fields1 = Reflector::Tie(aObject1);
+            const auto fields2 = Reflector::Tie(aObject2);
 
-        // we treat pointers to streamable in a special way
-        if constexpr (is_derived_from_pointer<Type, IStreamable>)
-        {
-            return ReadStreamablePtr(aPointer);
+            return [&]<size_t... vIndexes>(std::index_sequence<vIndexes...>) {
+                return (IsEqualBytes(std::get<vIndexes>(fields1), std::get<vIndexes>(fields2)) && ...);
+            }(std::make_index_sequence<std::tuple_size_v<decltype(fields1)>>{});
         }
         else
         {
-            return Read(*aPointer);
+            return !std::memcmp(&aObject1, &aObject2, sizeof(Type));
         }
     }
 
-    template <typename Type> constexpr decltype(auto) ReadStreamable(Type &aStreamable)
+    constexpr decltype(auto) WriteCount(const Size::size_max aSize)
     {
-        static_assert(std::derived_from<Type, IStreamable>, "Type is not a streamable!");
-
-        aStreamable.Deserialize(static_cast<Stream>(mStream->Read(ReadCount())),
-                                false); // read streamable size in bytes
+        mStream->Write(Size::MakeSize(aSize));
         return *this;
     }
 
-    template <typename Type> constexpr decltype(auto) ReadStreamablePtr(Type &aStreamablePtr)
+    [[nodiscard]] constexpr bool IsAligned() noexcept
     {
-        static_assert(is_derived_from_pointer<Type, IStreamable>, "Type is not a streamable smart/raw pointer!");
+        const auto context = mStream->GetContext();
+        return context && context->Has(StreamContext::Option::ALIGNED);
+    }
 
-        using TypeNoPtr = std::conditional_t<std::is_pointer_v<Type>, std::remove_pointer_t<Type>,
-                                             typename std::pointer_traits<Type>::element_type>;
+    [[nodiscard]] constexpr bool IsCanonical() noexcept
+    {
+        const auto context = mStream->GetContext();
+        return context && context->Has(StreamContext::Option::CANONICAL);
+    }
 
-        // we cannot use the has_method_find_derived_streamable concept because we must use the context of the
-        // StreamReader that is a friend of streamables
-        static_assert(
-            requires(StreamReader &aStreamReader) {
-                {
-                    TypeNoPtr::FindDerivedStreamable(aStreamReader)
-                } -> std::convertible_to<IStreamable *>;
-            }, "Type doesn't have a public/protected method 'static "
-               "IStreamable* FindDerivedStreamable(StreamReader &)' !");
+    // pads aligned streams so the next object starts at aAlignment from the start of the stream
+    constexpr decltype(auto) Align(const size_t aAlignment)
+    {
+        if (IsAligned())
+        {
+            constexpr std::array<uint8_t, ALIGNMENT_MAX> padding{};
+            mStream->Write({padding.data(), (aAlignment - mStream->View().size() % aAlignment) % aAlignment});
+        }
 
-        Peek([&](auto) {
-            Stream stream(mStream->Read(ReadCount())); // read streamable size in bytes
-            StreamReader streamReader(stream);
+        return *this;
+    }
 
-            // TODO: we let the user read n objects after wich we read again... fix it
-            if constexpr (is_smart_pointer<Type>)
-            {
-                aStreamablePtr.reset(static_cast<TypeNoPtr *>(TypeNoPtr::FindDerivedStreamable(streamReader)));
-            }
-            else
-            {
-                aStreamablePtr = dynamic_cast<TypeNoPtr *>(TypeNoPtr::FindDerivedStreamable(streamReader));
-            }
-        });
+    // the elements of empty ranges are not read, so they are not aligned
+    template <typename Type> constexpr decltype(auto) AlignRange(const Size::size_max aCount)
+    {
+        if (aCount)
+        {
+            Align(SizeFinder::FindRangeAlignment<Type>());
+        }
 
-        aStreamablePtr->Deserialize(static_cast<Stream>(mStream->Read(ReadCount())), false);
         return *this;
     }
 
-    template <typename Type> [[nodiscard]] constexpr Type ReadRange()
+    template <typename Type, bool vPolymorphic = false> constexpr decltype(auto) WriteStreamable(Type &aStreamable)
     {
-        static_assert(std::ranges::range<Type>, "Type is not a range!");
-
-        using TypeValueType = typename Type::value_type;
+        static_assert(std::derived_from<Type, IStreamable>, "Type is not a streamable!");
 
-        Type range{};
-        const auto count = ReadCount();
+        // nested streamables share our context and are not serialized from scratch
+        const auto context = mStream->GetContext();
+        const auto options = context ? context->mOptions : StreamContext::Option::NONE;
 
-        if constexpr (SizeFinder::FindRangeRank<Type>() > 1)
+        // a clean cached streamable is copied, it was written with the same options
+        constexpr auto cached = std::derived_from<Type, IStreamableCached>;
+        if constexpr (cached)
         {
-            for (size_t i = 0; i < count; i++)
+            if (aStreamable.IsCached(options))
             {
-                range.insert(std::ranges::cend(range), ReadRange<TypeValueType>());
+                WriteCount(aStreamable.mCache.size());
+                Align(ALIGNMENT_MAX);
+                return mStream->Write(aStreamable.mCache);
             }
         }
+
+        aStreamable.Swap(context ? Stream(*context) : Stream());
+
+        // a pointed object or one seen through a reference to its base needs the virtual call
+        if constexpr (vPolymorphic || std::is_abstract_v<Type>)
+        {
+            aStreamable.ToStream();
+        }
+        else if (std::is_final_v<Type> || typeid(aStreamable) == typeid(Type))
+        {
+            aStreamable.Type::ToStream();
+        }
         else
         {
-            ReadRangeRank1(range, count);
+            aStreamable.ToStream();
+        }
+
+        auto stream(std::move(aStreamable.Release()));
+        const auto streamView = stream.View();
+
+        if constexpr (cached)
+        {
+            if (!context || !context->Has(StreamContext::Option::IDENTITY))
+            {
+                aStreamable.Cache(streamView, options);
+            }
         }
 
-        return range;
+        // we write the size in bytes of the stream
+        WriteCount(streamView.size());
+        Align(ALIGNMENT_MAX);
+        return mStream->Write(streamView);
     }
 
-    template <typename Type> constexpr decltype(auto) ReadPath(Type &aRange, const Size::size_max aCount)
+    template <typename Type> constexpr decltype(auto) WritePointer(Type &aPointer)
     {
-        static_assert(is_path<Type>, "Type is not a path!");
-
-        using TypeStringType = typename Type::string_type;
-
-        TypeStringType pathNative{};
-        ReadRangeStandardLayout(pathNative, aCount);
-        aRange.assign(pathNative);
+        static_assert(is_any_pointer<Type>, "Type is not a smart/raw pointer!");
 
-        return *this;
-    }
+        using TypeNoPtr = std::conditional_t<std::is_pointer_v<Type>, std::remove_pointer_t<Type>,
+                                             typename std::pointer_traits<Type>::element_type>;
 
-    template <typename Type> constexpr StreamReader &ReadRangeStandardLayout(Type &aRange, const Size::size_max aCount)
-    {
-        static_assert(is_range_standard_layout<Type>, "Type is not a standard layout range!");
+        // shared objects are written only once, later they are written as a reference to the first one
+        if constexpr (is_shared_ptr_v<Type>)
+        {
+            const auto context = mStream->GetContext();
+            if (context && context->Has(StreamContext::Option::IDENTITY))
+            {
+                // the same address can hold different objects, like a class and its first member
+                auto &[identity, type] = context->mIdentitiesWritten[aPointer.get()];
+                if (identity && *type == typeid(TypeNoPtr))
+                {
+                    return WriteCount(identity);
+                }
 
-        using TypeValueType = typename Type::value_type;
+                identity = ++context->mIdentitiesWrittenCount;
+                type = &typeid(TypeNoPtr);
 
-        if (!aCount)
-        {
-            return *this;
+                WriteCount(0);
+            }
         }
 
-        if constexpr (is_utf16string<Type>)
+        // registered derived classes are prefixed by their index so the reader knows what to allocate
+        if constexpr (is_derived_from_pointer<Type, IStreamable> && has_streamable_derived<TypeNoPtr>)
         {
-            aRange.assign(Converter::Decode<Type>(mStream->Read(aCount)));
+            using TypeDerived = std::type_identity<typename TypeNoPtr::StreamableDerived>;
+            WriteCount(FindDerivedIndex(*aPointer, TypeDerived{}));
         }
-        else if constexpr (is_path<Type>)
+
+        if constexpr (is_derived_from_pointer<Type, IStreamable>)
         {
-            ReadPath(aRange, aCount);
+            WriteStreamable<TypeNoPtr, true>(*aPointer);
         }
         else
         {
-            const auto rangeView = mStream->Read(aCount * sizeof(TypeValueType));
-            const auto rangePtr = reinterpret_cast<const TypeValueType *>(rangeView.data());
-            aRange.assign(rangePtr, rangePtr + rangeView.size() / sizeof(TypeValueType));
+            Write(*aPointer);
         }
 
         return *this;
     }
 
-    template <typename Type> constexpr decltype(auto) ReadRangeRank1(Type &aRange, const Size::size_max aCount)
+    template <typename Type, typename... Types>
+    [[nodiscard]] static Size::size_max FindDerivedIndex(const Type &aStreamable,
+                                                         const std::type_identity<std::tuple<Types...>>)
     {
-        static_assert(std::ranges::range<Type>, "Type is not a range!");
+        static_assert(sizeof...(Types), "There are no registered derived streamables!");
 
-        using TypeValueType = typename Type::value_type;
+        // the exact class must be registered, else it would be read back as a base class
+        Size::size_max index{};
+        if (!((typeid(aStreamable) == typeid(Types) || (index++, false)) || ...))
+        {
+            throw std::out_of_range("The derived streamable is not registered!");
+        }
 
-        if constexpr (is_range_standard_layout<Type>)
+        return index;
+    }
+
+    template <typename Type> constexpr decltype(auto) WriteFixedExtent(Type &aRange)
+    {
+        static_assert(is_fixed_extent<Type>, "Type is not an array or a span of fixed extent!");
+
+        // the elements of arrays of known size are contiguous, spans point to them so we copy what they point to
+        if constexpr (is_known_size<Type>)
         {
-            ReadRangeStandardLayout(aRange, aCount);
+            WriteObjectOfKnownSize(aRange);
+        }
+        else if constexpr (is_span_v<Type> && is_known_size<typename Type::value_type>)
+        {
+            WriteBlock(aRange.data(), aRange.size());
         }
         else
         {
-            for (size_t i = 0; i < aCount; i++)
+            for (auto &object : aRange)
             {
-                TypeValueType object{};
-                Read(object);
-                aRange.insert(std::ranges::cend(aRange), std::move(object));
+                Write(object);
             }
         }
 
         return *this;
     }
 
-    template <typename Type> constexpr decltype(auto) ReadObjectOfKnownSize(Type &aObject)
+    template <typename Type> constexpr decltype(auto) WriteShaped(Type &aShaped)
     {
-        static_assert(is_standard_layout_no_pointer<Type>, "Type is not an object of known size or it is a pointer!");
+        static_assert(is_shaped<Type>, "Type is not a dense or rectangular array!");
 
-        if (!mStream->CanRead(sizeof(Type)))
+        // the rows have the same count, so the shape is written once instead of a count per row
+        if constexpr (is_dense_v<Type>)
         {
-            return *this;
+            std::ranges::for_each(aShaped.GetShape(), [&](const auto aExtent) { WriteCount(aExtent); });
+            Align(SizeFinder::FindAlignment<typename Type::value_type>());
+
+            const auto elements = aShaped.GetElements();
+            WriteBlock(elements.data(), elements.size());
         }
+        else
+        {
+            std::ranges::for_each(aShaped.FindShape(), [&](const auto aExtent) { WriteCount(aExtent); });
+            Align(SizeFinder::FindAlignment<typename Type::value_type>());
 
-        const auto view = mStream->Read(sizeof(Type));
-        aObject = *reinterpret_cast<const Type *>(view.data());
+            aShaped.ForEachRow([&](auto &aRow) {
+                const auto row = std::span(aRow);
+                WriteBlock(row.data(), row.size());
+            });
+        }
 
         return *this;
     }
 
-    inline Size::size_max ReadCount() noexcept
+    template <typename Type> constexpr decltype(auto) WriteColumnar(Type &aColumnar)
     {
-        if (!mStream->CanRead(1))
-        {
-            return 0;
-        }
+        static_assert(is_columnar_v<Type>, "Type is not a columnar range!");
 
-        const auto size = Size::FindRequiredBytes(mStream->Current());
-        if (!mStream->CanRead(size))
-        {
-            return 0;
-        }
+        WriteCount(aColumnar.FindCount());
 
-        return Size::MakeSize(mStream->Read(size));
-    }
-};
+        // the columns have the count of the records, the contiguous ones of known size are written as a single block
+        aColumnar.ForEachColumn([&](auto &&aColumn) {
+            using TypeColumn = std::remove_cvref_t<decltype(aColumn)>;
 
-class StreamWriter
-{
-  public:
-    constexpr explicit StreamWriter(Stream &aStream) noexcept : mStream(&aStream)
-    {
-    }
+            Align(SizeFinder::FindRangeAlignment<TypeColumn>());
+            if constexpr (std::ranges::contiguous_range<TypeColumn> && is_known_size<range_value_t<TypeColumn>>)
+            {
+                const auto column = std::span(aColumn);
+                WriteBlock(column.data(), column.size());
+            }
+            else
+            {
+                for (auto &&object : aColumn)
+                {
+                    Write(object);
+                }
+            }
+        });
 
-    constexpr StreamWriter(const StreamWriter &aStreamWriter) noexcept : mStream(aStreamWriter.mStream)
-    {
+        return *this;
     }
 
-    constexpr StreamWriter(StreamWriter &&aStreamWriter) noexcept
+    template <typename Type> constexpr decltype(auto) WriteRange(Type &aRange)
     {
-        *this = std::move(aStreamWriter);
-    }
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
 
-    template <typename Type, typename... Types> constexpr void WriteAll(Type &aObject, Types &...aObjects)
-    {
-        using TypeRaw = std::remove_cvref_t<Type>;
+        // the count of unsized ranges is inserted before their elements, that would move them from their alignment
+        if constexpr (!has_method_size<Type> && !is_path<Type>)
+        {
+            if (IsAligned())
+            {
+                std::vector<range_value_t<Type>> objects;
+                for (auto &&object : aRange)
+                {
+                    objects.push_back(std::forward<decltype(object)>(object));
+                }
 
-        Write<TypeRaw>(aObject);
+                return WriteRange(objects);
+            }
+        }
 
-        if constexpr (sizeof...(aObjects))
+        if constexpr (is_unordered<Type>)
         {
-            WriteAll<Types...>(aObjects...);
+            if (IsCanonical())
+            {
+                return WriteRangeCanonical(aRange);
+            }
         }
-    }
-
-    constexpr void WriteAll()
-    {
-    }
-
-    constexpr StreamWriter &operator=(const StreamWriter &aStreamWriter) noexcept
-    {
-        mStream = aStreamWriter.mStream;
-        return *this;
-    }
-
-    constexpr StreamWriter &operator=(StreamWriter &&aStreamWriter) noexcept
-    {
-        mStream = aStreamWriter.mStream;
-        return *this;
-    }
-
-  private:
-    Stream *mStream{};
-
-    template <typename Type> constexpr decltype(auto) WriteObjectOfKnownSize(Type &aObject)
-    {
-        static_assert(is_standard_layout_no_pointer<Type>, "Type is not an object of known size or it is a pointer!");
 
-        const auto objectPtr = reinterpret_cast<uint8_t *>(&aObject);
-        mStream->Write({objectPtr, sizeof(aObject)});
+        if constexpr (SizeFinder::FindRangeRank<Type>() > 1)
+        {
+            WriteRangeElements(aRange, [&](auto &aObject) { WriteRange(aObject); });
+        }
+        else
+        {
+            WriteRangeRank1(aRange);
+        }
 
         return *this;
     }
 
-    inline decltype(auto) WriteCount(const Size::size_max aSize)
+    // the order of unordered containers depends on their history, so their elements are sorted by their bytes
+    template <typename Type> constexpr decltype(auto) WriteRangeCanonical(Type &aRange)
     {
-        mStream->Write(Size::MakeSize(aSize));
-        return *this;
-    }
+        static_assert(is_unordered<Type>, "Type is not an unordered container!");
 
-    template <typename Type> constexpr decltype(auto) WriteStreamable(Type &aStreamable)
-    {
-        static_assert(std::derived_from<Type, IStreamable>, "Type is not a streamable!");
+        // the bytes to sort by don't depend on the other options, like the identities of the objects written before
+        StreamContext context(StreamContext::Option::CANONICAL);
 
-        auto stream(std::move(aStreamable.Serialize()));
-        const auto streamView = stream.View();
+        std::vector<std::pair<Stream::vector, decltype(&*std::ranges::begin(aRange))>> objects;
+        objects.reserve(SizeFinder::GetRangeCount(aRange));
+        for (auto &object : aRange)
+        {
+            Stream stream(context);
+            StreamWriter(stream).Write(object);
+            objects.emplace_back(stream.Release(), &object);
+        }
 
-        // we write the size in bytes of the stream
-        WriteCount(streamView.size());
-        return mStream->Write(streamView);
-    }
+        std::ranges::sort(objects, {}, &decltype(objects)::value_type::first);
 
-    template <typename Type> constexpr decltype(auto) WriteRange(Type &aRange)
-    {
-        static_assert(std::ranges::range<Type>, "Type is not a range!");
+        WriteCount(objects.size());
+        AlignRange<Type>(objects.size());
 
-        if constexpr (SizeFinder::FindRangeRank<Type>() > 1)
+        // without the other options the bytes sorted by are the ones we would write
+        if (!IsAligned() && !mStream->GetContext()->Has(StreamContext::Option::IDENTITY))
         {
-            WriteCount(SizeFinder::GetRangeCount(aRange));
-            for (auto &object : aRange)
+            for (auto &[bytes, object] : objects)
             {
-                WriteRange(object);
+                mStream->Write(bytes);
             }
+
+            return *this;
         }
-        else
+
+        for (auto &[bytes, object] : objects)
         {
-            WriteRangeRank1(aRange);
+            Write(*object);
         }
 
         return *this;
@@ -1046,9 +4591,7 @@ class StreamWriter
     {
         static_assert(is_range_standard_layout<Type>, "Type is not a standard layout range!");
 
-        using TypeValueType = typename Type::value_type;
-
-        if constexpr (is_utf16string<Type>)
+        if constexpr (is_wide_string<Type>)
         {
             WriteRangeStandardLayout(Converter::Encode(aRange));
         }
@@ -1059,10 +4602,19 @@ class StreamWriter
         else
         {
             WriteCount(SizeFinder::GetRangeCount(aRange));
+            AlignRange<Type>(SizeFinder::GetRangeCount(aRange));
+
+            if (std::is_constant_evaluated())
+            {
+                for (auto &object : aRange)
+                {
+                    WriteObjectOfKnownSize(object);
+                }
+
+                return *this;
+            }
 
-            const auto rangePtr = reinterpret_cast<const uint8_t *>(std::ranges::data(aRange));
-            const auto rangeSize = SizeFinder::GetRangeCount(aRange) * sizeof(TypeValueType);
-            mStream->Write({rangePtr, rangeSize});
+            WriteBlock(std::ranges::data(aRange), SizeFinder::GetRangeCount(aRange));
         }
 
         return *this;
@@ -1077,12 +4629,42 @@ class StreamWriter
             WriteRangeStandardLayout(aRange);
         }
         else
+        {
+            WriteRangeElements(aRange, [&](auto &aObject) { Write(aObject); });
+        }
+
+        return *this;
+    }
+
+    template <typename Type, typename FunctionWrite>
+    constexpr decltype(auto) WriteRangeElements(Type &aRange, FunctionWrite &&aFunctionWrite)
+    {
+        static_assert(std::ranges::range<Type>, "Type is not a range!");
+
+        if constexpr (has_method_size<Type>)
         {
             WriteCount(SizeFinder::GetRangeCount(aRange));
-            for (auto &object : aRange)
+            AlignRange<Type>(SizeFinder::GetRangeCount(aRange));
+
+            for (auto &&object : aRange)
             {
-                Write(object);
+                aFunctionWrite(object);
+            }
+        }
+        else
+        {
+            // unsized ranges (filters, generators etc...) may be traversed only once, so we count while writing and
+            // insert the count in front of the elements afterwards, the reader sees a normal range
+            const auto offset = mStream->View().size();
+
+            Size::size_max count{};
+            for (auto &&object : aRange)
+            {
+                aFunctionWrite(object);
+                count++;
             }
+
+            mStream->Insert(offset, Size::MakeSize(count));
         }
 
         return *this;
@@ -1132,6 +4714,29 @@ class StreamWriter
             auto &first = const_cast<std::remove_const_t<typename Type::first_type> &>(aObject.first);
             return WriteAll(first, aObject.second);
         }
+        else if constexpr (is_shaped<Type>)
+        {
+            return WriteShaped(aObject);
+        }
+        else if constexpr (is_columnar_v<Type>)
+        {
+            return WriteColumnar(aObject);
+        }
+        else if constexpr (is_fixed_extent<Type>)
+        {
+            return WriteFixedExtent(aObject);
+        }
+        else if constexpr (has_streamable_fields<Type>)
+        {
+            // the fields are written one after another, without a size in bytes like streamables
+            std::apply([&](auto &&...aArgs) { WriteAll(aArgs...); }, StreamableFields(aObject));
+            return *this;
+        }
+        else if constexpr (is_reflectable<Type>)
+        {
+            std::apply([&](auto &&...aArgs) { WriteAll(aArgs...); }, Reflector::Tie(aObject));
+            return *this;
+        }
         else if constexpr (std::ranges::range<Type>)
         {
             return WriteRange(aObject);
@@ -1142,7 +4747,7 @@ class StreamWriter
         }
         else if constexpr (is_any_pointer<Type>)
         {
-            return Write(*aObject);
+            return WritePointer(aObject);
         }
         else if constexpr (is_standard_layout_no_pointer<Type>)
         {
@@ -1170,8 +4775,23 @@ class IStreamable
         return Release();
     }
 
+    [[nodiscard]] decltype(auto) Serialize(StreamContext &aContext)
+    {
+        aContext.Clear();
+
+        Swap(Stream(aContext));
+        ToStream();
+        return Release();
+    }
+
     constexpr void Deserialize(Stream &&aStream, const bool aClear = true)
     {
+        if (const auto context = aStream.GetContext())
+        {
+            context->Clear();
+        }
+
+        Invalidate();
         Swap(std::move(aStream));
         FromStream();
 
@@ -1181,6 +4801,46 @@ class IStreamable
         }
     }
 
+    /*
+        Like Deserialize, but the errors of the stream are returned instead of thrown, the streamable is in an
+        unspecified state then. The exceptions of the allocations and of the user's code (FromStream, factories) are
+        still thrown.
+    */
+    [[nodiscard]] StreamContext::Result TryDeserialize(Stream &&aStream)
+    {
+        // without a context of the caller we use our own just for this deserialization
+        StreamContext contextOwn;
+        const auto context = aStream.GetContext() ? aStream.GetContext() : &contextOwn;
+        const auto view = aStream.View();
+
+        context->Clear();
+        context->mThrows = false;
+
+        Invalidate();
+        Swap(Stream(view, *context));
+
+        try
+        {
+            FromStream();
+        }
+        catch (...)
+        {
+            Swap(Stream());
+            context->mThrows = true;
+            throw;
+        }
+
+        Swap(Stream());
+        context->mThrows = true;
+
+        if (context->mStatus == StreamContext::Status::OK)
+        {
+            return {};
+        }
+
+        return {context->mStatus, static_cast<Size::size_max>(context->mStatusPosition - view.data())};
+    }
+
   protected:
     StreamWriter mStreamWriter;
     StreamReader mStreamReader;
@@ -1200,6 +4860,17 @@ class IStreamable
     {
     }
 
+    // called before the streamable is deserialized, it drops what depends on its old state
+    virtual void Invalidate() noexcept
+    {
+    }
+
+    // the columns of the bases, hidden by STREAMABLE_DEFINE_BASE
+    [[nodiscard]] constexpr std::tuple<> StreamableColumnsBases() noexcept
+    {
+        return {};
+    }
+
     [[nodiscard]] constexpr Stream &&Release() noexcept
     {
         return std::move(mStream);
@@ -1240,4 +4911,52 @@ class IStreamable
         return *this;
     }
 };
+
+/*
+    Streamable that keeps its last encoding, so when it's nested in another one it's copied instead of serialized again
+
+    The code changing it must call MarkDirty, also for the streamables that contain it because a clean streamable is
+    not visited, deserializing it (through a base too) marks it. The encoding is not kept when the shared pointers are
+    written by identity, it depends on the objects written before it.
+*/
+class IStreamableCached : public IStreamable
+{
+    friend class StreamWriter;
+    friend class StreamReader;
+
+    Stream::vector mCache;
+    StreamContext::Option mCacheOptions = StreamContext::Option::NONE;
+    bool mDirty = true;
+
+  public:
+    constexpr void MarkDirty() noexcept
+    {
+        mDirty = true;
+    }
+
+    [[nodiscard]] constexpr bool IsDirty() const noexcept
+    {
+        return mDirty;
+    }
+
+  protected:
+    constexpr IStreamableCached() noexcept = default;
+
+    void Invalidate() noexcept override
+    {
+        MarkDirty();
+    }
+
+    [[nodiscard]] constexpr bool IsCached(const StreamContext::Option aOptions) const noexcept
+    {
+        return !mDirty && mCacheOptions == aOptions;
+    }
+
+    constexpr void Cache(const Stream::span aStream, const StreamContext::Option aOptions)
+    {
+        mCache.assign(aStream.begin(), aStream.end());
+        mCacheOptions = aOptions;
+        mDirty = false;
+    }
+};
 } // namespace hbann